@@ -8,10 +8,15 @@ int
 main( const int argc, const char **argv )
 {
    LILC::LilC_Compiler compiler;
-   if (argc != 3){
-	std::cout << "Usage: P2 <infile> <outfile>" << std::endl;
+   int arg = 1;
+   if (argc == 4 && strcmp(argv[1], "--binary") == 0){
+	compiler.setDumpFormat(LILC::TokenDump::Format::BINARY);
+	arg++;
+   }
+   if (argc - arg != 2){
+	std::cout << "Usage: P2 [--binary] <infile> <outfile>" << std::endl;
 	return 1;
    }
-   compiler.scan( argv[1], argv[2] );
+   compiler.scan( argv[arg], argv[arg + 1] );
    return 0;
 }
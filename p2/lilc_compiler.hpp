@@ -4,8 +4,11 @@
 #include <string>
 #include <cstddef>
 #include <istream>
+#include <fstream>
 
 #include "lilc_scanner.hpp"
+#include "source_buffer.hpp"
+#include "token_dump.hpp"
 #include "symbols.hpp"
 #include "grammar.hh"
 
@@ -19,9 +22,15 @@ public:
 
    void scan( const char * const filename, const char * outfile );
    void parse( const char * const filename );
+   // How scan writes the tokens it finds
+   void setDumpFormat( TokenDump::Format f ){ dumpFormat = f; }
 private:
+   void openScanner( const char * const filename, std::ifstream &stream );
+
    LILC::LilC_Parser  *parser  = nullptr;
    LILC::LilC_Scanner *scanner = nullptr;
+   LILC::SourceBuffer source;
+   TokenDump::Format dumpFormat = TokenDump::Format::TEXT;
 };
 
 } /* end namespace */
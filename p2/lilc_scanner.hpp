@@ -24,6 +24,12 @@ public:
    // YY_DECL defined in the flex file lilc_lexer.l
    virtual
    int yylex( LILC::LilC_Parser::semantic_type * const lval );
+
+   // Scan size bytes at base in place instead of reading from the
+   // input stream, like flex's C-only yy_scan_buffer. base[size] and
+   // base[size+1] must be NUL and the memory must stay valid (and
+   // writable) for the life of the scanner. Defined in lilc_lexer.l.
+   bool scanBuffer(char * base, size_t size);
               
 
    void warn(int lineNum, int charNum, std::string msg){
@@ -0,0 +1,66 @@
+#include "source_buffer.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+bool LILC::SourceBuffer::map( const char * const filename )
+{
+   release();
+#ifdef _WIN32
+   return false;
+#else
+   int fd = open(filename, O_RDONLY);
+   if (fd < 0){ return false; }
+
+   struct stat info;
+   if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) || info.st_size == 0){
+      close(fd);
+      return false;
+   }
+
+   size_t fileSize = static_cast<size_t>(info.st_size);
+   size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+   size_t span = (fileSize + PADDING + page - 1) / page * page;
+
+   // Reserve zeroed anonymous memory large enough for the file plus its
+   // padding, then map the file over the front of it. The tail of the
+   // file's last page is zero-filled by the kernel and any page past it
+   // is still anonymous, so the padding reads as zeros either way, even
+   // when the file ends exactly on a page boundary.
+   void * region = mmap(nullptr, span, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (region == MAP_FAILED){
+      close(fd);
+      return false;
+   }
+   void * file = mmap(region, fileSize, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_FIXED, fd, 0);
+   close(fd);
+   if (file == MAP_FAILED){
+      munmap(region, span);
+      return false;
+   }
+   madvise(region, span, MADV_SEQUENTIAL);
+
+   base = static_cast<char *>(region);
+   length = fileSize;
+   mappingSize = span;
+   return true;
+#endif
+}
+
+void LILC::SourceBuffer::release()
+{
+#ifndef _WIN32
+   if (base != nullptr){
+      munmap(base, mappingSize);
+   }
+#endif
+   base = nullptr;
+   length = 0;
+   mappingSize = 0;
+}
@@ -0,0 +1,116 @@
+#include <cstring>
+
+#include "token_dump.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+LILC::TokenDump::TokenDump(std::ostream &out, Format format)
+: out(out), format(format), buffer(CAPACITY)
+{
+   if (format == Format::BINARY){
+      bytes("LILCTOK\1", 8);
+   }
+}
+
+void LILC::TokenDump::flush()
+{
+   if (used > 0){
+      out.write(buffer.data(), static_cast<std::streamsize>(used));
+      used = 0;
+   }
+   out.flush();
+}
+
+void LILC::TokenDump::token(int tag)
+{
+   if (format == Format::BINARY){
+      varint(static_cast<uint64_t>(tag));
+      return;
+   }
+   if (tag < 0 || tag > TokenSpellings::LAST
+      || TOKEN_SPELLINGS.text[tag] == nullptr){
+      // A tag with no spelling, written as scan always wrote one
+      bytes("UNKNOWN TOKEN\n", 14);
+      return;
+   }
+   size_t length = TOKEN_SPELLINGS.length[tag];
+   char * p = reserve(length + 1);
+   std::memcpy(p, TOKEN_SPELLINGS.text[tag], length);
+   p[length] = '\n';
+   used += length + 1;
+}
+
+void LILC::TokenDump::id(const char * text, size_t length)
+{
+   valued(TokenTag::ID, text, length);
+}
+
+void LILC::TokenDump::stringLit(const char * text, size_t length)
+{
+   valued(TokenTag::STRINGLITERAL, text, length);
+}
+
+void LILC::TokenDump::intLit(int value)
+{
+   // Literals are clamped to [0, INT_MAX] by the scanner
+   uint32_t v = static_cast<uint32_t>(value);
+   if (format == Format::BINARY){
+      varint(TokenTag::INTLITERAL);
+      varint(v);
+      return;
+   }
+   char digits[10];
+   size_t n = 0;
+   do {
+      digits[n++] = static_cast<char>('0' + v % 10);
+      v /= 10;
+   } while (v != 0);
+
+   size_t prefix = TOKEN_SPELLINGS.length[TokenTag::INTLITERAL];
+   char * p = reserve(prefix + n + 1);
+   std::memcpy(p, TOKEN_SPELLINGS.text[TokenTag::INTLITERAL], prefix);
+   p += prefix;
+   for (size_t i = 0; i < n; i++){
+      p[i] = digits[n - 1 - i];
+   }
+   p[n] = '\n';
+   used += prefix + n + 1;
+}
+
+void LILC::TokenDump::valued(int tag, const char * text, size_t length)
+{
+   if (format == Format::BINARY){
+      varint(static_cast<uint64_t>(tag));
+      varint(length);
+   } else {
+      bytes(TOKEN_SPELLINGS.text[tag], TOKEN_SPELLINGS.length[tag]);
+   }
+   bytes(text, length);
+   if (format == Format::TEXT){
+      bytes("\n", 1);
+   }
+}
+
+void LILC::TokenDump::bytes(const char * text, size_t length)
+{
+   if (length > CAPACITY){
+      // Too big to be worth copying; keep the output in order though
+      flush();
+      out.write(text, static_cast<std::streamsize>(length));
+      return;
+   }
+   std::memcpy(reserve(length), text, length);
+   used += length;
+}
+
+void LILC::TokenDump::varint(uint64_t value)
+{
+   char * p = reserve(10);
+   size_t n = 0;
+   while (value >= 0x80){
+      p[n++] = static_cast<char>((value & 0x7F) | 0x80);
+      value >>= 7;
+   }
+   p[n++] = static_cast<char>(value);
+   used += n;
+}
@@ -1,18 +1,118 @@
 #include <iostream>
 #include <cstdlib>
 #include <cstring>
+#include <string>
+#include <vector>
 
 #include "lilc_compiler.hpp"
 
+static int usage(){
+	std::cout << "Usage: P3 [--scan [--binary]] [--lexer=flex|simd] "
+		"[--parser=bison|descent] [--threads=N] [--parse-threads=N] [--pipeline] [--unparse-threads=N] "
+		"[--ast=tree|flat] [--share-exps] [--cache=DIR] [--edit=OFFSET,REMOVED,TEXT]... "
+		"<infile> <outfile>"
+		<< std::endl;
+	return 1;
+}
+
+// An edit of the input made in memory once it is scanned or parsed:
+// REMOVED bytes at OFFSET replaced by TEXT, in which \n is a newline
+// and \\ a backslash
+struct Edit{
+	size_t offset;
+	size_t removed;
+	std::string text;
+};
+
+static bool parseEdit(const char *spec, Edit &edit){
+	char *end;
+	edit.offset = strtoul(spec, &end, 10);
+	if (*end != ','){ return false; }
+	edit.removed = strtoul(end + 1, &end, 10);
+	if (*end != ','){ return false; }
+	edit.text.clear();
+	for (const char *p = end + 1; *p != '\0'; p++){
+		if (*p == '\\' && (p[1] == 'n' || p[1] == '\\')){
+			edit.text += p[1] == 'n' ? '\n' : '\\';
+			p++;
+		} else {
+			edit.text += *p;
+		}
+	}
+	return true;
+}
+
 int 
 main( const int argc, const char **argv )
 {
-   if (argc != 3){
-	std::cout << "Usage: P3 <infile> <outfile>" << std::endl;
-	return 1;
+   LILC::LilC_Compiler compiler;
+   bool scanOnly = false;
+   std::vector<Edit> edits;
+   int arg = 1;
+   for (; arg < argc && strncmp(argv[arg], "--", 2) == 0; arg++){
+	if (strcmp(argv[arg], "--scan") == 0){
+		scanOnly = true;
+	} else if (strcmp(argv[arg], "--binary") == 0){
+		compiler.setDumpFormat(LILC::TokenDump::Format::BINARY);
+	} else if (strcmp(argv[arg], "--lexer=flex") == 0){
+		compiler.setLexer(LILC::LilC_Scanner::Backend::FLEX);
+	} else if (strcmp(argv[arg], "--lexer=simd") == 0){
+		compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	} else if (strcmp(argv[arg], "--parser=bison") == 0){
+		compiler.setParser(LILC::LilC_Compiler::ParserBackend::BISON);
+	} else if (strcmp(argv[arg], "--parser=descent") == 0){
+		compiler.setParser(LILC::LilC_Compiler::ParserBackend::DESCENT);
+	} else if (strcmp(argv[arg], "--ast=tree") == 0){
+		compiler.setASTForm(LILC::LilC_Compiler::ASTForm::TREE);
+	} else if (strcmp(argv[arg], "--ast=flat") == 0){
+		compiler.setASTForm(LILC::LilC_Compiler::ASTForm::FLAT);
+	} else if (strcmp(argv[arg], "--share-exps") == 0){
+		compiler.setSharedExps(true);
+	} else if (strncmp(argv[arg], "--cache=", 8) == 0){
+		compiler.setCacheDir(argv[arg] + 8);
+	} else if (strcmp(argv[arg], "--pipeline") == 0){
+		compiler.setPipelined(true);
+	} else if (strncmp(argv[arg], "--parse-threads=", 16) == 0){
+		compiler.setParseThreads(strtoul(argv[arg] + 16, nullptr, 10));
+	} else if (strncmp(argv[arg], "--unparse-threads=", 18) == 0){
+		compiler.setUnparseThreads(strtoul(argv[arg] + 18, nullptr, 10));
+	} else if (strncmp(argv[arg], "--threads=", 10) == 0){
+		compiler.setLexThreads(strtoul(argv[arg] + 10, nullptr, 10));
+	} else if (strncmp(argv[arg], "--edit=", 7) == 0){
+		edits.emplace_back();
+		if (!parseEdit(argv[arg] + 7, edits.back())){
+			return usage();
+		}
+	} else {
+		return usage();
+	}
+   }
+   if (argc - arg != 2){
+	return usage();
    }
 
-   LILC::LilC_Compiler compiler;
-   compiler.parse( argv[1], argv[2] );
+   // With edits, what is written is the edited input's, brought up to
+   // date edit by edit rather than scanned or parsed again
+   const char *outfile = edits.empty() ? argv[arg + 1] : "/dev/null";
+   if (scanOnly){
+	compiler.scan( argv[arg], outfile );
+	for (const Edit &edit : edits){
+		compiler.rescan( edit.offset, edit.removed, edit.text.data(),
+			edit.text.size() );
+	}
+	if (!edits.empty()){
+		compiler.writeTokens( argv[arg + 1] );
+	}
+   } else {
+	compiler.parse( argv[arg], outfile );
+	bool parsed = true;
+	for (size_t i = 0; i < edits.size() && parsed; i++){
+		parsed = compiler.reparse( edits[i].offset, edits[i].removed,
+			edits[i].text.data(), edits[i].text.size() );
+	}
+	if (!edits.empty() && parsed){
+		compiler.unparse( argv[arg + 1] );
+	}
+   }
    return 0;
 }
@@ -0,0 +1,139 @@
+#ifndef __LILC_ARENA_HPP__
+#define __LILC_ARENA_HPP__ 1
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace LILC{
+
+/*
+Bump allocator for objects that all die at the same time, such as the
+tokens of one compilation. Memory comes from large blocks and is only
+given back by reset() or the destructor, which free everything at
+once. Objects that need their destructor run are recorded in a list
+(itself stored in the arena) and destroyed in reverse order on reset.
+ */
+class Arena{
+public:
+   Arena() = default;
+   ~Arena(){ reset(); freeBlocks(head); }
+   Arena(const Arena&) = delete;
+   Arena& operator=(const Arena&) = delete;
+
+   void * allocate(size_t size, size_t align){
+	size_t pad = (align - reinterpret_cast<size_t>(cursor)) & (align - 1);
+	if (cursor == nullptr || size + pad > static_cast<size_t>(limit - cursor)){
+		grow(size + align);
+		pad = (align - reinterpret_cast<size_t>(cursor)) & (align - 1);
+	}
+	char * result = cursor + pad;
+	cursor = result + size;
+	allocations++;
+	return result;
+   }
+
+   template <typename T, typename... Args>
+   T * make(Args&&... args){
+	T * obj = new (allocate(sizeof(T), alignof(T)))
+		T(std::forward<Args>(args)...);
+	if (!std::is_trivially_destructible<T>::value){
+		Finalizer * f = static_cast<Finalizer *>(
+			allocate(sizeof(Finalizer), alignof(Finalizer)));
+		f->obj = obj;
+		f->destroy = &destroyObject<T>;
+		f->next = finalizers;
+		finalizers = f;
+	}
+	return obj;
+   }
+
+   // Destroy everything allocated so far. The first block is kept so
+   // that a compiler reused for several compilations doesn't go back
+   // to malloc for the common small case.
+   void reset();
+
+   size_t allocationCount() const { return allocations; }
+   size_t blockCount() const { return blocks; }
+   // Bytes taken from malloc, whether handed out yet or not
+   size_t footprint() const {
+	size_t bytes = 0;
+	for (Block * b = head; b != nullptr; b = b->next){ bytes += b->size; }
+	return bytes;
+   }
+
+   static const size_t BLOCK_SIZE = 64 * 1024;
+private:
+   struct Block{
+	Block * next;
+	size_t size;
+   };
+   struct Finalizer{
+	void * obj;
+	void (*destroy)(void *);
+	Finalizer * next;
+   };
+
+   template <typename T>
+   static void destroyObject(void * obj){ static_cast<T *>(obj)->~T(); }
+
+   void grow(size_t minSize);
+   static void freeBlocks(Block * block);
+
+   Block * head = nullptr;
+   char * cursor = nullptr;
+   char * limit = nullptr;
+   Finalizer * finalizers = nullptr;
+   size_t allocations = 0;
+   size_t blocks = 0;
+};
+
+inline void Arena::grow(size_t minSize){
+	size_t size = BLOCK_SIZE;
+	while (size - sizeof(Block) < minSize){ size *= 2; }
+	Block * block = static_cast<Block *>(std::malloc(size));
+	if (block == nullptr){ throw std::bad_alloc(); }
+	block->next = head;
+	block->size = size;
+	head = block;
+	blocks++;
+	cursor = reinterpret_cast<char *>(block + 1);
+	limit = reinterpret_cast<char *>(block) + size;
+}
+
+inline void Arena::freeBlocks(Block * block){
+	while (block != nullptr){
+		Block * next = block->next;
+		std::free(block);
+		block = next;
+	}
+}
+
+inline void Arena::reset(){
+	for (Finalizer * f = finalizers; f != nullptr; f = f->next){
+		f->destroy(f->obj);
+	}
+	finalizers = nullptr;
+	allocations = 0;
+	if (head == nullptr){ return; }
+
+	// Blocks are pushed on the front, so the first one is at the tail.
+	Block * first = head;
+	while (first->next != nullptr){ first = first->next; }
+	if (first != head){
+		Block * rest = head;
+		while (rest->next != first){ rest = rest->next; }
+		rest->next = nullptr;
+		freeBlocks(head);
+	}
+	head = first;
+	blocks = 1;
+	cursor = reinterpret_cast<char *>(first + 1);
+	limit = reinterpret_cast<char *>(first) + first->size;
+}
+
+} /* end namespace */
+
+#endif /* END __LILC_ARENA_HPP__ */
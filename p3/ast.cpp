@@ -1,2 +1,248 @@
 // Use this file if you'd like to implement any auxilary functions in your 
 // AST nodes
+
+#include "ast_walker.hpp"
+
+namespace LILC{
+
+// Out-of-line definition: Arena::make takes its arguments by reference
+const int VarDeclNode::NOT_STRUCT;
+
+} //End namespace LIL' C
+
+// **********************************************************************
+// flatten: a post-order walk that appends each node to the flat AST
+// once its children are there (see flat_ast.hpp)
+// **********************************************************************
+
+namespace LILC{
+
+namespace {
+
+class Flattener : public TreeWalker<Flattener, ASTTree>{
+public:
+	Flattener(const ASTTree & tree, FlatAST& flat) : TreeWalker(tree), flat(flat){}
+
+	template <NodeKind K>
+	void pre(ASTNode *, NoArg){
+		marks.push_back(results.size());
+	}
+
+	// The ids of the children of n are on results above its mark;
+	// they are replaced by the id of n
+	template <NodeKind K>
+	void post(ASTNode * n, NoArg){
+		if (K == NodeKind::RETURN_STMT
+		    && static_cast<ReturnStmtNode *>(n)->exp() == nullptr){
+			results.push_back(FlatAST::NONE);
+		}
+		size_t count = results.size() - marks.back();
+		marks.pop_back();
+		const FlatAST::NodeId * kids = results.data() + results.size() - count;
+		FlatAST::NodeId id;
+		switch (K){
+		case NodeKind::VAR_DECL:
+			id = flat.addVarDecl(n->loc(), kids[0], kids[1],
+				static_cast<VarDeclNode *>(n)->size());
+			break;
+		case NodeKind::ID:
+			id = flat.addId(n->loc(), static_cast<IdNode *>(n)->name());
+			break;
+		case NodeKind::INT_LIT:
+			id = flat.addIntLit(n->loc(), static_cast<IntLitNode *>(n)->value());
+			break;
+		case NodeKind::STR_LIT:
+			{
+			StrLitNode * lit = static_cast<StrLitNode *>(n);
+			id = flat.addStrLit(n->loc(), lit->text(), lit->length());
+			break;
+			}
+		default:
+			id = flat.add(K, n->loc(), kids, count);
+			break;
+		}
+		results.resize(results.size() - count);
+		results.push_back(id);
+	}
+
+	FlatAST::NodeId result() const { return results.back(); }
+private:
+
+	FlatAST& flat;
+	std::vector<FlatAST::NodeId> results;
+	std::vector<size_t> marks;
+};
+
+} // end anonymous namespace
+
+FlatAST::NodeId ASTNode::flatten(FlatAST& flat){
+	ASTTree tree;
+	Flattener flattener(tree, flat);
+	flattener.walk(this);
+	return flattener.result();
+}
+
+} //End namespace LIL' C
+
+// **********************************************************************
+// structuralHash: a Merkle hash of each subtree, made bottom-up in one
+// post-order walk from the kind of each node, its value if it is a
+// leaf with one, and the hashes of its children in order. Locations
+// play no part, and names and literals are hashed by their spelling,
+// so equal code hashes the same in any compilation and any file.
+// **********************************************************************
+
+namespace LILC{
+
+namespace {
+
+// Adds v to h. Order matters, so children in another order hash
+// differently
+uint64_t mix(uint64_t h, uint64_t v){
+	h ^= v + 0x9E3779B97F4A7C15ULL;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	return h ^ (h >> 31);
+}
+
+// The arg passed down is whether the child is the name a function or
+// struct is declared with, which that node's own hash leaves out
+class StructuralHasher : public TreeWalker<StructuralHasher, ASTTree, bool>{
+public:
+	StructuralHasher(const ASTTree & tree) : TreeWalker(tree){}
+
+	template <NodeKind K>
+	void pre(ASTNode *, bool){
+		if (!isLeaf(K)){
+			open.push_back(seed(K));
+		}
+	}
+
+	template <NodeKind K>
+	bool beforeChild(ASTNode *, size_t i, bool){
+		return (K == NodeKind::FN_DECL && i == 1)
+			|| (K == NodeKind::STRUCT_DECL && i == 0);
+	}
+
+	template <NodeKind K>
+	void post(ASTNode * n, bool declaredName){
+		uint64_t h = seed(K);
+		if (!isLeaf(K)){
+			h = open.back();
+			open.pop_back();
+		}
+		switch (K){
+		case NodeKind::ID:
+			h = mix(h, static_cast<IdNode *>(n)->name().hash());
+			break;
+		case NodeKind::INT_LIT:
+			h = mix(h, static_cast<uint32_t>(static_cast<IntLitNode *>(n)->value()));
+			break;
+		case NodeKind::STR_LIT:
+			{
+			StrLitNode * lit = static_cast<StrLitNode *>(n);
+			h = mix(h, Interner::hashBytes(lit->text(), lit->length()));
+			break;
+			}
+		case NodeKind::VAR_DECL:
+			h = mix(h, static_cast<uint32_t>(static_cast<VarDeclNode *>(n)->size()));
+			break;
+		case NodeKind::FN_DECL:
+			{
+			FnDeclNode * fn = static_cast<FnDeclNode *>(n);
+			fn->setHash(h);
+			h = mix(h, fn->id()->name().hash());
+			break;
+			}
+		case NodeKind::STRUCT_DECL:
+			{
+			StructDeclNode * decl = static_cast<StructDeclNode *>(n);
+			decl->setHash(h);
+			h = mix(h, decl->id()->name().hash());
+			break;
+			}
+		case NodeKind::ASSIGN_STMT:
+		case NodeKind::POST_INC_STMT:
+		case NodeKind::POST_DEC_STMT:
+		case NodeKind::READ_STMT:
+		case NodeKind::WRITE_STMT:
+		case NodeKind::IF_STMT:
+		case NodeKind::IF_ELSE_STMT:
+		case NodeKind::WHILE_STMT:
+		case NodeKind::CALL_STMT:
+		case NodeKind::RETURN_STMT:
+			static_cast<StmtNode *>(n)->setHash(h);
+			break;
+		default:
+			break;
+		}
+		if (open.empty()){
+			result = h;
+		} else if (!declaredName){
+			open.back() = mix(open.back(), h);
+		}
+	}
+
+	uint64_t result = 0;
+private:
+	static uint64_t seed(NodeKind k){ return mix(0, static_cast<uint64_t>(k) + 1); }
+
+	// Leaves never have children to add, so need no place on open
+	static bool isLeaf(NodeKind k){
+		return k == NodeKind::ID || k == NodeKind::INT_LIT
+			|| k == NodeKind::STR_LIT || k == NodeKind::TRUE_LIT
+			|| k == NodeKind::FALSE_LIT || k == NodeKind::INT_TYPE
+			|| k == NodeKind::BOOL_TYPE || k == NodeKind::VOID_TYPE;
+	}
+
+	// The hash so far of each node whose children are being walked
+	std::vector<uint64_t> open;
+};
+
+} // end anonymous namespace
+
+uint64_t ASTNode::structuralHash(){
+	ASTTree tree;
+	StructuralHasher hasher(tree);
+	hasher.walk(this, false);
+	return hasher.result;
+}
+
+} //End namespace LIL' C
+
+// **********************************************************************
+// relocate: a pre-order walk that moves each node's location by the
+// same amount and re-points string literals, whose text is in the
+// source buffer, at the edited one
+// **********************************************************************
+
+namespace LILC{
+
+namespace {
+
+class Relocator : public TreeWalker<Relocator, ASTTree>{
+public:
+	Relocator(const ASTTree & tree, int64_t delta, const char * source)
+	: TreeWalker(tree), delta(delta), source(source){}
+
+	template <NodeKind K>
+	void pre(ASTNode * n, NoArg){
+		SourceLoc at(static_cast<uint32_t>(n->loc().offset + delta));
+		n->setLoc(at);
+		if (K == NodeKind::STR_LIT){
+			static_cast<StrLitNode *>(n)->setText(source + at.offset);
+		}
+	}
+private:
+	int64_t delta;
+	const char * source;
+};
+
+} // end anonymous namespace
+
+void ASTNode::relocate(int64_t delta, const char * source){
+	ASTTree tree;
+	Relocator relocator(tree, delta, source);
+	relocator.walk(this);
+}
+
+} //End namespace LIL' C
@@ -2,7 +2,10 @@
 #define LILC_AST_HPP
 
 #include <ostream>
-#include <list>
+#include <vector>
+#include "flat_ast.hpp"
+#include "node_array.hpp"
+#include "node_kind.hpp"
 #include "symbols.hpp"
 
 //Here is a suggestion for all the different kinds of AST nodes
@@ -14,17 +17,17 @@
 //     Subclass		Children
 //     --------		------
 //     ProgramNode	DeclListNode
-//     DeclListNode	linked list of DeclNode
+//     DeclListNode	array of DeclNode
 //     DeclNode
 //       VarDeclNode	TypeNode, IdNode, int
 //       FnDeclNode	TypeNode, IdNode, FormalsListNode, FnBodyNode
 //       FormalDeclNode    TypeNode, IdNode
 //       StructDeclNode    IdNode, DeclListNode
 //
-//     FormalsListNode     linked list of FormalDeclNode
+//     FormalsListNode     array of FormalDeclNode
 //     FnBodyNode          DeclListNode, StmtListNode
-//     StmtListNode        linked list of StmtNode
-//     ExpListNode         linked list of ExpNode
+//     StmtListNode        array of StmtNode
+//     ExpListNode         array of ExpNode
 //
 //     TypeNode:
 //       IntNode           -- none --
@@ -80,7 +83,7 @@
 //        IntNode,   BoolNode,  VoidNode,  IntLitNode,  StrLitNode,
 //        TrueNode,  FalseNode, IdNode
 //
-// (2) Internal nodes with (possibly empty) linked lists of children:
+// (2) Internal nodes with (possibly empty) arrays of children:
 //        DeclListNode, FormalsListNode, StmtListNode, ExpListNode
 //
 // (3) Internal nodes with fixed numbers of kids:
@@ -96,13 +99,29 @@
 //
 // **********************************************************************
 
+
 // **********************************************************************
 // ASTnode class (base class for all other kinds of nodes)
+//
+// Nodes are made in the compilation's AST arena (Arena::make, see the
+// nodes parse-param in lilc.yy) and are never deleted one at a time;
+// the whole tree goes when the arena is reset for the next compilation.
+// With shared expressions on (exp_table.hpp) an expression node can
+// have several parents, so the tree is then a DAG; walking it still
+// visits every occurrence.
+//
+// Nodes have no virtual functions. Each one records its NodeKind, and
+// passes over the tree switch on it: ASTVisitors (ast_visitor.hpp)
+// recurse, TreeWalkers (ast_walker.hpp) keep their own stack and are
+// what whole-program passes use, as trees can be very deep. The
+// accessors below are what both read children through.
 // **********************************************************************
 
 namespace LILC{
 
 class SymSymbol;
+class ThreadPool;
+class OutputBuffer;
 class DeclListNode;
 class DeclNode;
 class TypeNode;
@@ -110,18 +129,46 @@ class IdNode;
 
 class ASTNode{
 public:
-	virtual void unparse(std::ostream& out, int indent) = 0;
+	ASTNode(SourceLoc loc, NodeKind kind) : myLoc(loc), myKind(kind){}
+	// Both passes are TreeWalkers: unparse.cpp and ast.cpp
+	void unparse(std::ostream& out, int indent = 0);
+	// Appends this subtree to flat, children first
+	FlatAST::NodeId flatten(FlatAST& flat);
+	// Hashes this subtree by its structure alone, leaving out source
+	// locations, and records the hash of every statement, function and
+	// struct in it; see ast.cpp
+	uint64_t structuralHash();
+	// After an edit of the source, for a subtree kept as it was: moves
+	// every location in it by delta, the change in length of the text
+	// before it, and points its string literals at their text in the
+	// edited source; see ast.cpp
+	void relocate(int64_t delta, const char * source);
+	// Where the source text of this node starts
+	SourceLoc loc() const { return myLoc; }
+	void setLoc(SourceLoc loc){ myLoc = loc; }
+	NodeKind kind() const { return myKind; }
 	void doIndent(std::ostream& out, int indent){
-		for (int k = 0 ; k < indent; k++){ out << " "; }
+		static const char run[] = "                ";
+		const int RUN = sizeof(run) - 1;
+		for (int k = indent; k > 0; k -= RUN){
+			out.write(run, k < RUN ? k : RUN);
+		}
 	}
+private:
+	SourceLoc myLoc;
+	NodeKind myKind;
 };
 
 class ProgramNode : public ASTNode{
 public:
-	ProgramNode(DeclListNode * L) : ASTNode(){
+	ProgramNode(SourceLoc loc, DeclListNode * L) : ASTNode(loc, NodeKind::PROGRAM){
 		myDeclList = L;
 	}
-	void unparse(std::ostream& out, int indent);
+	DeclListNode * declList() const { return myDeclList; }
+	using ASTNode::unparse;
+	// The top-level declarations unparsed on pool, in runs, into
+	// parts; written out in order they are the program's unparse
+	void unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts);
 private:
 	DeclListNode * myDeclList;
 
@@ -129,26 +176,27 @@ private:
 
 class DeclListNode : public ASTNode{
 public:
-	DeclListNode(std::list<DeclNode *> * decls) : ASTNode(){
-		myDecls = *decls;
+	DeclListNode(SourceLoc loc, NodeList<DeclNode *> && decls) : ASTNode(loc, NodeKind::DECL_LIST){
+		myDecls = decls.take();
 	}
-	void unparse(std::ostream& out, int indent);
+	NodeArray<DeclNode *> decls() const { return myDecls; }
 private:
-	std::list<DeclNode *> myDecls;
+	NodeArray<DeclNode *> myDecls;
 };
 
 class DeclNode : public ASTNode{
 public:
-	virtual void unparse(std::ostream& out, int indent) = 0;
+	DeclNode(SourceLoc loc, NodeKind kind) : ASTNode(loc, kind){}
 };
 
 class FormalDeclNode : public DeclNode{
 public:
-	FormalDeclNode(TypeNode * type, IdNode * id) : DeclNode(){
+	FormalDeclNode(SourceLoc loc, TypeNode * type, IdNode * id) : DeclNode(loc, NodeKind::FORMAL_DECL){
 		myType = type;
 		myId = id;
 	}
-	void unparse(std::ostream& out, int indent);
+	TypeNode * type() const { return myType; }
+	IdNode * id() const { return myId; }
 private:
 	TypeNode * myType;
 	IdNode * myId;
@@ -156,95 +204,103 @@ private:
 
 class FormalsListNode : public ASTNode{
 public:
-	FormalsListNode(std::list<FormalDeclNode *> * formals) : ASTNode(){
-		myFormals = *formals;
+	FormalsListNode(SourceLoc loc, NodeList<FormalDeclNode *> && formals) : ASTNode(loc, NodeKind::FORMALS_LIST){
+		myFormals = formals.take();
 	}
-	void unparse(std::ostream& out, int indent);
+	NodeArray<FormalDeclNode *> formals() const { return myFormals; }
 private:
-	std::list<FormalDeclNode *> myFormals;
+	NodeArray<FormalDeclNode *> myFormals;
 };
 
 class StmtNode : public ASTNode{
 public:
-	virtual void unparse(std::ostream& out, int indent) = 0;
+	StmtNode(SourceLoc loc, NodeKind kind) : ASTNode(loc, kind){}
+	// Set by structuralHash; 0 until then
+	uint64_t hash() const { return myHash; }
+	void setHash(uint64_t hash){ myHash = hash; }
+private:
+	uint64_t myHash = 0;
 };
 
 class StmtListNode : public ASTNode{
 public:
-	StmtListNode(std::list<StmtNode *> * stmts) : ASTNode(){
-		myStmts = *stmts;
+	StmtListNode(SourceLoc loc, NodeList<StmtNode *> && stmts) : ASTNode(loc, NodeKind::STMT_LIST){
+		myStmts = stmts.take();
 	}
-	void unparse(std::ostream& out, int indent);
+	NodeArray<StmtNode *> stmts() const { return myStmts; }
 private:
-	std::list<StmtNode *> myStmts;
+	NodeArray<StmtNode *> myStmts;
 };
 
 class ExpNode : public ASTNode{
 public:
-	ExpNode() : ASTNode(){
+	ExpNode(SourceLoc loc, NodeKind kind) : ASTNode(loc, kind){
 	}
-	virtual void unparse(std::ostream& out, int indent) = 0;
 };
 
 class ExpListNode : public ASTNode{
 public:
-	ExpListNode(std::list<ExpNode *> * exps) : ASTNode(){
-		myExps = *exps;
+	ExpListNode(SourceLoc loc, NodeList<ExpNode *> && exps) : ASTNode(loc, NodeKind::EXP_LIST){
+		myExps = exps.take();
 	}
-	void unparse(std::ostream& out, int indent);
+	NodeArray<ExpNode *> exps() const { return myExps; }
 private:
-	std::list<ExpNode *> myExps;
+	NodeArray<ExpNode *> myExps;
 };
 
 class IntLitNode : public ExpNode{
 public:
-	IntLitNode(int value) : ExpNode(){
+	IntLitNode(SourceLoc loc, int value) : ExpNode(loc, NodeKind::INT_LIT){
 		myVal = value;
 	}
-	void unparse(std::ostream& out, int indent);
+	int value() const { return myVal; }
 private:
 	int myVal;
 };
 
 class StrLitNode : public ExpNode{
 public:
-	StrLitNode(std::string * strVal) : ExpNode(){
-		myStrVal = *strVal;
+	StrLitNode(StringLitToken * token) : ExpNode(token->loc(), NodeKind::STR_LIT){
+		myText = token->text();
+		myLength = token->length();
 	}
-	void unparse(std::ostream& out, int indent);
+	const char * text() const { return myText; }
+	size_t length() const { return myLength; }
+	void setText(const char * text){ myText = text; }
 private:
-	std::string myStrVal;
+	// The literal as written, in the compilation's source buffer
+	const char * myText;
+	size_t myLength;
 };
 
 class TrueNode : public ExpNode{
 public:
-	TrueNode() : ExpNode(){}
-	void unparse(std::ostream& out, int indent);
+	TrueNode(SourceLoc loc) : ExpNode(loc, NodeKind::TRUE_LIT){}
 };
 
 class FalseNode : public ExpNode{
 public:
-	FalseNode() : ExpNode(){}
-	void unparse(std::ostream& out, int indent);
+	FalseNode(SourceLoc loc) : ExpNode(loc, NodeKind::FALSE_LIT){}
 };
 
 class IdNode : public ExpNode{
 public:
-	IdNode(IDToken * token) : ExpNode(){
-		myStrVal = token->value();
+	IdNode(IDToken * token) : ExpNode(token->loc(), NodeKind::ID){
+		myName = token->value();
 	}
-	void unparse(std::ostream& out, int indent);
+	Atom name() const { return myName; }
 private:
-	std::string myStrVal;
+	Atom myName;
 };
 
 class DotAccessNode : public ExpNode{
 public:
-	DotAccessNode(ExpNode * expression, IdNode* id) : ExpNode(){
+	DotAccessNode(SourceLoc loc, ExpNode * expression, IdNode* id) : ExpNode(loc, NodeKind::DOT_ACCESS){
 		myExp = expression;
 		myId = id;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
+	IdNode * id() const { return myId; }
 private:
 	ExpNode* myExp;
 	IdNode* myId;
@@ -252,11 +308,12 @@ private:
 
 class AssignNode : public ExpNode{
 public:
-	AssignNode(ExpNode * expL, ExpNode* expR) : ExpNode(){
+	AssignNode(SourceLoc loc, ExpNode * expL, ExpNode* expR) : ExpNode(loc, NodeKind::ASSIGN){
 		myExpL = expL;
 		myExpR = expR;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * lhs() const { return myExpL; }
+	ExpNode * rhs() const { return myExpR; }
 private:
 	ExpNode* myExpL;
 	ExpNode* myExpR;
@@ -264,11 +321,12 @@ private:
 
 class CallExpNode : public ExpNode{
 public:
-	CallExpNode(IdNode* id, ExpListNode * expList) : ExpNode(){
+	CallExpNode(SourceLoc loc, IdNode* id, ExpListNode * expList) : ExpNode(loc, NodeKind::CALL_EXP){
 		myExpList = expList;
 		myId = id;
 	}
-	void unparse(std::ostream& out, int indent);
+	IdNode * id() const { return myId; }
+	ExpListNode * args() const { return myExpList; }
 private:
 	ExpListNode* myExpList;
 	IdNode* myId;
@@ -276,33 +334,32 @@ private:
 
 class UnaryExpNode : public ExpNode{
 public:
-	UnaryExpNode(ExpNode * expression) : ExpNode(){
+	UnaryExpNode(SourceLoc loc, NodeKind kind, ExpNode * expression) : ExpNode(loc, kind){
 		myExp = expression;
 	}
-	virtual void unparse(std::ostream& out, int indent) = 0;
+	ExpNode * exp() const { return myExp; }
 protected:
 	ExpNode* myExp;
 };
 
 class UnaryMinusNode : public UnaryExpNode{
 public:
-	UnaryMinusNode(ExpNode * expression) : UnaryExpNode(expression){}
-	void unparse(std::ostream& out, int indent);
+	UnaryMinusNode(SourceLoc loc, ExpNode * expression) : UnaryExpNode(loc, NodeKind::UNARY_MINUS, expression){}
 };
 
 class NotNode : public UnaryExpNode{
 public:
-	NotNode(ExpNode * expression) : UnaryExpNode(expression){}
-	void unparse(std::ostream& out, int indent);
+	NotNode(SourceLoc loc, ExpNode * expression) : UnaryExpNode(loc, NodeKind::NOT, expression){}
 };
 
 class BinaryExpNode : public ExpNode{
 public:
-	BinaryExpNode(ExpNode * expL, ExpNode* expR) : ExpNode(){
+	BinaryExpNode(SourceLoc loc, NodeKind kind, ExpNode * expL, ExpNode* expR) : ExpNode(loc, kind){
 		myExpL = expL;
 		myExpR = expR;
 	}
-	virtual void unparse(std::ostream& out, int indent) = 0;
+	ExpNode * lhs() const { return myExpL; }
+	ExpNode * rhs() const { return myExpR; }
 protected:
 	ExpNode* myExpL;
 	ExpNode* myExpR;
@@ -310,84 +367,74 @@ protected:
 
 class PlusNode : public BinaryExpNode{
 public:
-	PlusNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	PlusNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::PLUS, expL, expR){}
 };
 
 class MinusNode : public BinaryExpNode{
 public:
-	MinusNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	MinusNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::MINUS, expL, expR){}
 };
 
 class TimesNode : public BinaryExpNode{
 public:
-	TimesNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	TimesNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::TIMES, expL, expR){}
 };
 
 class DivideNode : public BinaryExpNode{
 public:
-	DivideNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	DivideNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::DIVIDE, expL, expR){}
 };
 
 class AndNode : public BinaryExpNode{
 public:
-	AndNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	AndNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::AND, expL, expR){}
 };
 
 class OrNode : public BinaryExpNode{
 public:
-	OrNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	OrNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::OR, expL, expR){}
 };
 
 class EqualsNode : public BinaryExpNode{
 public:
-	EqualsNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	EqualsNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::EQUALS, expL, expR){}
 };
 
 class NotEqualsNode : public BinaryExpNode{
 public:
-	NotEqualsNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	NotEqualsNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::NOT_EQUALS, expL, expR){}
 };
 
 class LessNode : public BinaryExpNode{
 public:
-	LessNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	LessNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::LESS, expL, expR){}
 };
 
 class GreaterNode : public BinaryExpNode{
 public:
-	GreaterNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	GreaterNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::GREATER, expL, expR){}
 };
 
 class LessEqNode : public BinaryExpNode{
 public:
-	LessEqNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	LessEqNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::LESS_EQ, expL, expR){}
 };
 
 class GreaterEqNode : public BinaryExpNode{
 public:
-	GreaterEqNode(ExpNode * expL, ExpNode * expR) : BinaryExpNode(expL, expR){}
-	void unparse(std::ostream& out, int indent);
+	GreaterEqNode(SourceLoc loc, ExpNode * expL, ExpNode * expR) : BinaryExpNode(loc, NodeKind::GREATER_EQ, expL, expR){}
 };
 
 class VarDeclNode : public DeclNode{
 public:
-	VarDeclNode(TypeNode * type, IdNode * id, int size) : DeclNode(){
+	VarDeclNode(SourceLoc loc, TypeNode * type, IdNode * id, int size) : DeclNode(loc, NodeKind::VAR_DECL){
 		myType = type;
 		myId = id;
 		mySize = size;
 	}
-	void unparse(std::ostream& out, int indent);
+	TypeNode * type() const { return myType; }
+	IdNode * id() const { return myId; }
+	int size() const { return mySize; }
 	static const int NOT_STRUCT = -1; //Use this value for mySize
 					  // if this is not a struct type
 private:
@@ -398,11 +445,12 @@ private:
 
 class FnBodyNode : public DeclNode{
 public:
-	FnBodyNode(DeclListNode * declList, StmtListNode * stmtList) : DeclNode(){
+	FnBodyNode(SourceLoc loc, DeclListNode * declList, StmtListNode * stmtList) : DeclNode(loc, NodeKind::FN_BODY){
 		myDeclList = declList;
 		myStmtList = stmtList;
 	}
-	void unparse(std::ostream& out, int indent);
+	DeclListNode * declList() const { return myDeclList; }
+	StmtListNode * stmtList() const { return myStmtList; }
 private:
 	DeclListNode * myDeclList;
 	StmtListNode * myStmtList;
@@ -410,128 +458,140 @@ private:
 
 class FnDeclNode : public DeclNode{
 public:
-	FnDeclNode(TypeNode * type, IdNode * id, FormalsListNode * formalsList, FnBodyNode * fnBody) : DeclNode(){
+	FnDeclNode(SourceLoc loc, TypeNode * type, IdNode * id, FormalsListNode * formalsList, FnBodyNode * fnBody) : DeclNode(loc, NodeKind::FN_DECL){
 		myType = type;
 		myId = id;
 		myFormalsList = formalsList;
 		myFnBody = fnBody;
 	}
-	void unparse(std::ostream& out, int indent);
+	TypeNode * type() const { return myType; }
+	IdNode * id() const { return myId; }
+	FormalsListNode * formalsList() const { return myFormalsList; }
+	FnBodyNode * body() const { return myFnBody; }
+	// Set by structuralHash; 0 until then. Covers everything but the
+	// function's name, so copies under different names share it
+	uint64_t hash() const { return myHash; }
+	void setHash(uint64_t hash){ myHash = hash; }
 private:
 	TypeNode * myType;
 	IdNode * myId;
 	FormalsListNode * myFormalsList;
 	FnBodyNode * myFnBody;
+	uint64_t myHash = 0;
 };
 
 class StructDeclNode : public DeclNode{
 public:
-	StructDeclNode(DeclListNode * declList, IdNode * id) : DeclNode(){
+	StructDeclNode(SourceLoc loc, DeclListNode * declList, IdNode * id) : DeclNode(loc, NodeKind::STRUCT_DECL){
 		myDeclList = declList;
 		myId = id;
 	}
-	void unparse(std::ostream& out, int indent);
+	DeclListNode * declList() const { return myDeclList; }
+	IdNode * id() const { return myId; }
+	// Set by structuralHash; 0 until then. Covers the fields but not
+	// the struct's name
+	uint64_t hash() const { return myHash; }
+	void setHash(uint64_t hash){ myHash = hash; }
 private:
 	DeclListNode * myDeclList;
 	IdNode * myId;
+	uint64_t myHash = 0;
 };
 
 class TypeNode : public ASTNode{
 public:
-	TypeNode() : ASTNode(){
+	TypeNode(SourceLoc loc, NodeKind kind) : ASTNode(loc, kind){
 	}
-	virtual void unparse(std::ostream& out, int indent) = 0;
 };
 
 class IntNode : public TypeNode{
 public:
-	IntNode(): TypeNode(){
+	IntNode(SourceLoc loc) : TypeNode(loc, NodeKind::INT_TYPE){
 	}
-	void unparse(std::ostream& out, int indent);
 };
 
 class BoolNode : public TypeNode{
 public:
-	BoolNode(): TypeNode(){
+	BoolNode(SourceLoc loc) : TypeNode(loc, NodeKind::BOOL_TYPE){
 	}
-	void unparse(std::ostream& out, int indent);
 };
 
 class VoidNode : public TypeNode{
 public:
-	VoidNode(): TypeNode(){
+	VoidNode(SourceLoc loc) : TypeNode(loc, NodeKind::VOID_TYPE){
 	}
-	void unparse(std::ostream& out, int indent);
 };
 
 class StructNode : public TypeNode{
 public:
-	StructNode(IdNode * id): TypeNode(){
+	StructNode(SourceLoc loc, IdNode * id) : TypeNode(loc, NodeKind::STRUCT_TYPE){
 		myId = id;
 	}
-	void unparse(std::ostream& out, int indent);
+	IdNode * id() const { return myId; }
 private:
 	IdNode * myId;
 };
 
 class AssignStmtNode : public StmtNode{
 public:
-	AssignStmtNode(AssignNode* assignNode): StmtNode(){
+	AssignStmtNode(SourceLoc loc, AssignNode* assignNode) : StmtNode(loc, NodeKind::ASSIGN_STMT){
 		myAssignNode = assignNode;
 	}
-	void unparse(std::ostream& out, int indent);
+	AssignNode * assign() const { return myAssignNode; }
 private:
 	AssignNode* myAssignNode;
 };
 
 class PostIncStmtNode : public StmtNode{
 public:
-	PostIncStmtNode(ExpNode* exp): StmtNode(){
+	PostIncStmtNode(SourceLoc loc, ExpNode* exp) : StmtNode(loc, NodeKind::POST_INC_STMT){
 		myExp = exp;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
 private:
 	ExpNode* myExp;
 };
 
 class PostDecStmtNode : public StmtNode{
 public:
-	PostDecStmtNode(ExpNode* exp): StmtNode(){
+	PostDecStmtNode(SourceLoc loc, ExpNode* exp) : StmtNode(loc, NodeKind::POST_DEC_STMT){
 		myExp = exp;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
 private:
 	ExpNode* myExp;
 };
 
 class ReadStmtNode : public StmtNode{
 public:
-	ReadStmtNode(ExpNode* exp): StmtNode(){
+	ReadStmtNode(SourceLoc loc, ExpNode* exp) : StmtNode(loc, NodeKind::READ_STMT){
 		myExp = exp;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
 private:
 	ExpNode* myExp;
 };
 
 class WriteStmtNode : public StmtNode{
 public:
-	WriteStmtNode(ExpNode* exp): StmtNode(){
+	WriteStmtNode(SourceLoc loc, ExpNode* exp) : StmtNode(loc, NodeKind::WRITE_STMT){
 		myExp = exp;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
 private:
 	ExpNode* myExp;
 };
 
 class IfStmtNode : public StmtNode{
 public:
-	IfStmtNode(ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList): StmtNode(){
+	IfStmtNode(SourceLoc loc, ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList) : StmtNode(loc, NodeKind::IF_STMT){
 		myExp = exp;
 		myDeclList = declList;
 		myStmtList = stmtList;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
+	DeclListNode * declList() const { return myDeclList; }
+	StmtListNode * stmtList() const { return myStmtList; }
 private:
 	ExpNode* myExp;
 	DeclListNode* myDeclList;
@@ -540,14 +600,18 @@ private:
 
 class IfElseStmtNode : public StmtNode{
 public:
-	IfElseStmtNode(ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList, DeclListNode* declList2, StmtListNode* stmtList2): StmtNode(){
+	IfElseStmtNode(SourceLoc loc, ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList, DeclListNode* declList2, StmtListNode* stmtList2) : StmtNode(loc, NodeKind::IF_ELSE_STMT){
 		myExp = exp;
 		myDeclList = declList;
 		myStmtList = stmtList;
 		myDeclList2 = declList2;
 		myStmtList2 = stmtList2;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
+	DeclListNode * declList() const { return myDeclList; }
+	StmtListNode * stmtList() const { return myStmtList; }
+	DeclListNode * elseDeclList() const { return myDeclList2; }
+	StmtListNode * elseStmtList() const { return myStmtList2; }
 private:
 	ExpNode* myExp;
 	DeclListNode* myDeclList;
@@ -558,12 +622,14 @@ private:
 
 class WhileStmtNode : public StmtNode{
 public:
-	WhileStmtNode(ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList): StmtNode(){
+	WhileStmtNode(SourceLoc loc, ExpNode* exp, DeclListNode* declList, StmtListNode* stmtList) : StmtNode(loc, NodeKind::WHILE_STMT){
 		myExp = exp;
 		myDeclList = declList;
 		myStmtList = stmtList;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * exp() const { return myExp; }
+	DeclListNode * declList() const { return myDeclList; }
+	StmtListNode * stmtList() const { return myStmtList; }
 private:
 	ExpNode* myExp;
 	DeclListNode* myDeclList;
@@ -572,20 +638,21 @@ private:
 
 class CallStmtNode : public StmtNode{
 public:
-	CallStmtNode(ExpNode* call): StmtNode(){
+	CallStmtNode(SourceLoc loc, ExpNode* call) : StmtNode(loc, NodeKind::CALL_STMT){
 		myCall = call;
 	}
-	void unparse(std::ostream& out, int indent);
+	ExpNode * call() const { return myCall; }
 private:
 	ExpNode* myCall;
 };
 
 class ReturnStmtNode : public StmtNode{
 public:
-	ReturnStmtNode(ExpNode* exp): StmtNode(){
+	ReturnStmtNode(SourceLoc loc, ExpNode* exp) : StmtNode(loc, NodeKind::RETURN_STMT){
 		myExp = exp;
 	}
-	void unparse(std::ostream& out, int indent);
+	// nullptr for a bare return;
+	ExpNode * exp() const { return myExp; }
 private:
 	ExpNode* myExp;
 };
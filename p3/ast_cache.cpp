@@ -0,0 +1,248 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "ast_cache.hpp"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace {
+
+const char MAGIC[8] = { 'L', 'I', 'L', 'A', 'S', 'T', '\0', '\0' };
+// Reads back as something else on a machine of the other byte order
+const uint32_t ORDER_MARK = 0x01020304;
+
+struct Header{
+	char magic[8];
+	uint32_t version;
+	uint32_t byteOrder;
+	uint64_t sourceHash;
+	uint64_t sourceSize;
+	uint32_t nodes;
+	uint32_t edges;
+	uint32_t atoms;
+	uint32_t strings;
+	uint64_t chars;
+};
+
+uint64_t mix(uint64_t h, uint64_t v){
+	h ^= v + 0x9E3779B97F4A7C15ULL;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	return h ^ (h >> 31);
+}
+
+template <typename T>
+void writeArray(std::ostream & out, const std::vector<T> & v){
+	out.write(reinterpret_cast<const char *>(v.data()), v.size() * sizeof(T));
+}
+
+} // end anonymous namespace
+
+const LILC::ASTImage::NodeId LILC::ASTImage::NONE;
+const uint32_t LILC::ASTImage::VERSION;
+
+uint64_t LILC::ASTImage::contentHash(const char * text, size_t size)
+{
+   uint64_t hash = mix(0, size);
+   size_t i = 0;
+   for (; i + 8 <= size; i += 8){
+      uint64_t word;
+      std::memcpy(&word, text + i, 8);
+      hash = mix(hash, word);
+   }
+   uint64_t tail = 0;
+   std::memcpy(&tail, text + i, size - i);
+   return mix(hash, tail);
+}
+
+bool LILC::ASTImage::write(const FlatAST & flat, const char * path,
+uint64_t sourceHash, size_t sourceSize)
+{
+   static_assert(sizeof(SourceLoc) == sizeof(uint32_t),
+      "locs are saved as they are");
+   if (flat.empty()){
+      return false;
+   }
+   // Spellings go in chars in this order: names, then literals
+   std::vector<Span> atomSpans(flat.atoms.size(), Span());
+   std::vector<Span> stringSpans(flat.strings.size(), Span());
+   uint64_t chars = 0;
+   for (size_t i = 0; i < flat.atoms.size(); i++){
+      if (!flat.atoms[i].valid()){ continue; }
+      atomSpans[i].offset = static_cast<uint32_t>(chars);
+      atomSpans[i].length = static_cast<uint32_t>(flat.atoms[i].size());
+      chars += flat.atoms[i].size();
+   }
+   for (size_t i = 0; i < flat.strings.size(); i++){
+      stringSpans[i].offset = static_cast<uint32_t>(chars);
+      stringSpans[i].length = flat.strings[i].length;
+      chars += flat.strings[i].length;
+   }
+   if (chars > UINT32_MAX || flat.edges.size() > UINT32_MAX){
+      return false;
+   }
+
+   Header header;
+   std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+   header.version = VERSION;
+   header.byteOrder = ORDER_MARK;
+   header.sourceHash = sourceHash;
+   header.sourceSize = sourceSize;
+   header.nodes = static_cast<uint32_t>(flat.size());
+   header.edges = static_cast<uint32_t>(flat.edges.size());
+   header.atoms = static_cast<uint32_t>(atomSpans.size());
+   header.strings = static_cast<uint32_t>(stringSpans.size());
+   header.chars = chars;
+
+   std::string temp = std::string(path) + ".tmp"
+#ifndef _WIN32
+      + std::to_string(getpid())
+#endif
+      ;
+   std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+   out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+   writeArray(out, flat.data);
+   writeArray(out, flat.locs);
+   writeArray(out, flat.edges);
+   writeArray(out, atomSpans);
+   writeArray(out, stringSpans);
+   writeArray(out, flat.kinds);
+   for (Atom name : flat.atoms){
+      if (name.valid()){ out.write(name.c_str(), name.size()); }
+   }
+   for (const FlatAST::StrSpan & s : flat.strings){
+      out.write(s.text, s.length);
+   }
+   out.close();
+   if (!out || std::rename(temp.c_str(), path) != 0){
+      std::remove(temp.c_str());
+      return false;
+   }
+   return true;
+}
+
+bool LILC::ASTImage::open(const char * path, uint64_t sourceHash,
+size_t sourceSize)
+{
+   close();
+#ifdef _WIN32
+   return false;
+#else
+   int fd = ::open(path, O_RDONLY);
+   if (fd < 0){ return false; }
+   struct stat info;
+   if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)
+       || static_cast<size_t>(info.st_size) < sizeof(Header)){
+      ::close(fd);
+      return false;
+   }
+   size_t fileSize = static_cast<size_t>(info.st_size);
+   void * region = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+   ::close(fd);
+   if (region == MAP_FAILED){ return false; }
+   base = static_cast<char *>(region);
+   mappingSize = fileSize;
+
+   Header header;
+   std::memcpy(&header, base, sizeof(header));
+   if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+       || header.version != VERSION || header.byteOrder != ORDER_MARK
+       || header.sourceHash != sourceHash || header.sourceSize != sourceSize
+       || header.nodes == 0){
+      close();
+      return false;
+   }
+   nodeCount = header.nodes;
+   edgeCount = header.edges;
+   atomCount = header.atoms;
+   stringCount = header.strings;
+   charCount = header.chars;
+   uint64_t expected = sizeof(Header)
+      + 4 * uint64_t(nodeCount) * 2 + 4 * uint64_t(edgeCount)
+      + sizeof(Span) * (uint64_t(atomCount) + stringCount)
+      + nodeCount + charCount;
+   if (expected != fileSize){
+      close();
+      return false;
+   }
+
+   const char * at = base + sizeof(Header);
+   data = reinterpret_cast<const uint32_t *>(at);
+   at += 4 * nodeCount;
+   locs = reinterpret_cast<const uint32_t *>(at);
+   at += 4 * nodeCount;
+   edges = reinterpret_cast<const uint32_t *>(at);
+   at += 4 * edgeCount;
+   atoms = reinterpret_cast<const Span *>(at);
+   at += sizeof(Span) * atomCount;
+   strings = reinterpret_cast<const Span *>(at);
+   at += sizeof(Span) * stringCount;
+   kinds = reinterpret_cast<const uint8_t *>(at);
+   at += nodeCount;
+   chars = at;
+
+   if (!wellFormed()){
+      close();
+      return false;
+   }
+   return true;
+#endif
+}
+
+void LILC::ASTImage::close()
+{
+#ifndef _WIN32
+   if (base != nullptr){
+      munmap(base, mappingSize);
+   }
+#endif
+   base = nullptr;
+   mappingSize = 0;
+   nodeCount = edgeCount = atomCount = stringCount = charCount = 0;
+}
+
+bool LILC::ASTImage::wellFormed() const
+{
+   for (size_t i = 0; i < atomCount; i++){
+      if (uint64_t(atoms[i].offset) + atoms[i].length > charCount){ return false; }
+   }
+   for (size_t i = 0; i < stringCount; i++){
+      if (uint64_t(strings[i].offset) + strings[i].length > charCount){ return false; }
+   }
+   for (size_t n = 0; n < nodeCount; n++){
+      if (kinds[n] >= NODE_KIND_COUNT){ return false; }
+      NodeKind k = static_cast<NodeKind>(kinds[n]);
+      int arity = FlatAST::ARITY[kinds[n]];
+      uint64_t first = data[n];
+      if (k == NodeKind::ID){
+         if (first >= atomCount){ return false; }
+         continue;
+      }
+      if (k == NodeKind::STR_LIT){
+         if (first >= stringCount){ return false; }
+         continue;
+      }
+      if (arity == 0){
+         continue;
+      }
+      uint64_t count = arity;
+      if (arity == FlatAST::LIST){
+         if (first >= edgeCount){ return false; }
+         count = edges[first++];
+      }
+      uint64_t extra = k == NodeKind::VAR_DECL ? 1 : 0;
+      if (first + count + extra > edgeCount){ return false; }
+      for (uint64_t i = 0; i < count; i++){
+         NodeId c = edges[first + i];
+         if (c != NONE && c >= n){ return false; }
+      }
+   }
+   return kind(root()) == NodeKind::PROGRAM;
+}
@@ -0,0 +1,143 @@
+#ifndef __LILC_AST_CACHE_HPP__
+#define __LILC_AST_CACHE_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "flat_ast.hpp"
+#include "node_kind.hpp"
+#include "source_loc.hpp"
+
+namespace LILC{
+
+class ThreadPool;
+class OutputBuffer;
+
+/*
+A FlatAST saved to a .lilast file and mapped back in. The file holds
+the flat arrays as they are, with every pointer turned into an offset
+into the file, so a loaded image is read in place: opening one costs a
+mapping and a pass that checks every index is in bounds, and nothing
+is allocated per node. It has the same interface as FlatAST for
+TreeWalker, so anything written for that walks an image too.
+
+Layout, in native byte order (the header records which):
+
+   header   magic, VERSION, the counts below, and the hash and size
+            of the source the tree was parsed from
+   data     one word per node, as in FlatAST
+   locs     one SourceLoc per node
+   edges    FlatAST's edges
+   atoms    {offset, length} in chars of each identifier, by atom id
+   strings  {offset, length} in chars of each string literal
+   kinds    one byte per node
+   chars    the spellings
+
+An image is only opened for the source it was made from: the hash,
+size, version and byte order must all match, or open fails and the
+caller parses instead. write goes through a temporary file and a
+rename, so a reader never sees half of one.
+ */
+class ASTImage{
+public:
+	typedef FlatAST::NodeId NodeId;
+	typedef NodeId Node;
+	static const NodeId NONE = FlatAST::NONE;
+	// Bump whenever the layout, or the meaning of anything in it,
+	// changes
+	static const uint32_t VERSION = 1;
+
+	// An identifier's spelling, which is all a name is in an image
+	struct Spelling{
+		const char * chars;
+		size_t length;
+	};
+
+	ASTImage() = default;
+	~ASTImage(){ close(); }
+	ASTImage(const ASTImage&) = delete;
+	ASTImage& operator=(const ASTImage&) = delete;
+
+	// Map the image at path if it holds a tree of the source with
+	// this hash and size
+	bool open(const char * path, uint64_t sourceHash, size_t sourceSize);
+	void close();
+	bool loaded() const { return base != nullptr; }
+
+	size_t size() const { return nodeCount; }
+	NodeId root() const { return static_cast<NodeId>(nodeCount - 1); }
+
+	NodeKind kind(NodeId n) const { return static_cast<NodeKind>(kinds[n]); }
+	static bool present(NodeId n){ return n != NONE; }
+	SourceLoc loc(NodeId n) const { return SourceLoc(locs[n]); }
+	template <NodeKind K, typename F>
+	void forEachChild(NodeId n, F && f) const {
+		const int arity = FlatAST::ARITY[static_cast<int>(K)];
+		if (arity == 0){
+			return;
+		}
+		const uint32_t * first = edges + data[n];
+		size_t count = arity;
+		if (arity == FlatAST::LIST){
+			count = *first++;
+		}
+		for (size_t i = 0; i < count; i++){ f(i, first[i]); }
+	}
+
+	Spelling name(NodeId n) const {
+		Spelling s = { chars + atoms[data[n]].offset, atoms[data[n]].length };
+		return s;
+	}
+	int intValue(NodeId n) const { return static_cast<int>(data[n]); }
+	const char * strText(NodeId n) const { return chars + strings[data[n]].offset; }
+	size_t strLength(NodeId n) const { return strings[data[n]].length; }
+	int varDeclSize(NodeId n) const {
+		return static_cast<int>(edges[data[n] + 2]);
+	}
+
+	// Same output as FlatAST::unparse; defined with it in unparse.cpp
+	void unparse(std::ostream& out) const;
+	void unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts) const;
+
+	// Save flat, parsed from a source with this hash and size
+	static bool write(const FlatAST & flat, const char * path,
+		uint64_t sourceHash, size_t sourceSize);
+	// What images are keyed by; reads the source a word at a time
+	static uint64_t contentHash(const char * text, size_t size);
+private:
+	struct Span{
+		uint32_t offset;
+		uint32_t length;
+	};
+
+	// Every child, name and literal of every node is inside the
+	// image, and children come before their parents, so any walk
+	// stays in bounds and ends
+	bool wellFormed() const;
+
+	char * base = nullptr;
+	size_t mappingSize = 0;
+
+	size_t nodeCount = 0;
+	size_t edgeCount = 0;
+	size_t atomCount = 0;
+	size_t stringCount = 0;
+	size_t charCount = 0;
+	const uint32_t * data = nullptr;
+	const uint32_t * locs = nullptr;
+	const uint32_t * edges = nullptr;
+	const Span * atoms = nullptr;
+	const Span * strings = nullptr;
+	const uint8_t * kinds = nullptr;
+	const char * chars = nullptr;
+};
+
+inline std::ostream & operator<<(std::ostream & out, ASTImage::Spelling s){
+	return out.write(s.chars, s.length);
+}
+
+} /* end namespace */
+
+#endif /* END __LILC_AST_CACHE_HPP__ */
@@ -0,0 +1,183 @@
+#ifndef __LILC_AST_VISITOR_HPP__
+#define __LILC_AST_VISITOR_HPP__ 1
+
+#include "ast.hpp"
+
+namespace LILC{
+
+/*
+Base for passes over the AST. A pass derives from
+ASTVisitor<Pass, Result, Args...> and defines visitX(XNode *, Args...)
+for the node classes it cares about; visit(node, args...) calls the one
+matching the node's kind. Dispatch is a switch on NodeKind, which the
+compiler makes a jump table, and the call through the derived class is
+static, so pass bodies can be inlined into it.
+
+A visitX the pass doesn't define falls back to the one for the node's
+base class (visitBinaryExp, visitExp, ...) and finally to visitNode,
+which does nothing and returns Result().
+ */
+template <typename Derived, typename Result = void, typename... Args>
+class ASTVisitor{
+public:
+	Result visit(ASTNode * node, Args... args){
+		switch (node->kind()){
+		case NodeKind::PROGRAM:
+			return self().visitProgram(static_cast<ProgramNode *>(node), args...);
+		case NodeKind::DECL_LIST:
+			return self().visitDeclList(static_cast<DeclListNode *>(node), args...);
+		case NodeKind::VAR_DECL:
+			return self().visitVarDecl(static_cast<VarDeclNode *>(node), args...);
+		case NodeKind::FN_DECL:
+			return self().visitFnDecl(static_cast<FnDeclNode *>(node), args...);
+		case NodeKind::FORMAL_DECL:
+			return self().visitFormalDecl(static_cast<FormalDeclNode *>(node), args...);
+		case NodeKind::STRUCT_DECL:
+			return self().visitStructDecl(static_cast<StructDeclNode *>(node), args...);
+		case NodeKind::FORMALS_LIST:
+			return self().visitFormalsList(static_cast<FormalsListNode *>(node), args...);
+		case NodeKind::FN_BODY:
+			return self().visitFnBody(static_cast<FnBodyNode *>(node), args...);
+		case NodeKind::STMT_LIST:
+			return self().visitStmtList(static_cast<StmtListNode *>(node), args...);
+		case NodeKind::EXP_LIST:
+			return self().visitExpList(static_cast<ExpListNode *>(node), args...);
+		case NodeKind::INT_TYPE:
+			return self().visitInt(static_cast<IntNode *>(node), args...);
+		case NodeKind::BOOL_TYPE:
+			return self().visitBool(static_cast<BoolNode *>(node), args...);
+		case NodeKind::VOID_TYPE:
+			return self().visitVoid(static_cast<VoidNode *>(node), args...);
+		case NodeKind::STRUCT_TYPE:
+			return self().visitStruct(static_cast<StructNode *>(node), args...);
+		case NodeKind::ASSIGN_STMT:
+			return self().visitAssignStmt(static_cast<AssignStmtNode *>(node), args...);
+		case NodeKind::POST_INC_STMT:
+			return self().visitPostIncStmt(static_cast<PostIncStmtNode *>(node), args...);
+		case NodeKind::POST_DEC_STMT:
+			return self().visitPostDecStmt(static_cast<PostDecStmtNode *>(node), args...);
+		case NodeKind::READ_STMT:
+			return self().visitReadStmt(static_cast<ReadStmtNode *>(node), args...);
+		case NodeKind::WRITE_STMT:
+			return self().visitWriteStmt(static_cast<WriteStmtNode *>(node), args...);
+		case NodeKind::IF_STMT:
+			return self().visitIfStmt(static_cast<IfStmtNode *>(node), args...);
+		case NodeKind::IF_ELSE_STMT:
+			return self().visitIfElseStmt(static_cast<IfElseStmtNode *>(node), args...);
+		case NodeKind::WHILE_STMT:
+			return self().visitWhileStmt(static_cast<WhileStmtNode *>(node), args...);
+		case NodeKind::CALL_STMT:
+			return self().visitCallStmt(static_cast<CallStmtNode *>(node), args...);
+		case NodeKind::RETURN_STMT:
+			return self().visitReturnStmt(static_cast<ReturnStmtNode *>(node), args...);
+		case NodeKind::INT_LIT:
+			return self().visitIntLit(static_cast<IntLitNode *>(node), args...);
+		case NodeKind::STR_LIT:
+			return self().visitStrLit(static_cast<StrLitNode *>(node), args...);
+		case NodeKind::TRUE_LIT:
+			return self().visitTrue(static_cast<TrueNode *>(node), args...);
+		case NodeKind::FALSE_LIT:
+			return self().visitFalse(static_cast<FalseNode *>(node), args...);
+		case NodeKind::ID:
+			return self().visitId(static_cast<IdNode *>(node), args...);
+		case NodeKind::DOT_ACCESS:
+			return self().visitDotAccess(static_cast<DotAccessNode *>(node), args...);
+		case NodeKind::ASSIGN:
+			return self().visitAssign(static_cast<AssignNode *>(node), args...);
+		case NodeKind::CALL_EXP:
+			return self().visitCallExp(static_cast<CallExpNode *>(node), args...);
+		case NodeKind::UNARY_MINUS:
+			return self().visitUnaryMinus(static_cast<UnaryMinusNode *>(node), args...);
+		case NodeKind::NOT:
+			return self().visitNot(static_cast<NotNode *>(node), args...);
+		case NodeKind::PLUS:
+			return self().visitPlus(static_cast<PlusNode *>(node), args...);
+		case NodeKind::MINUS:
+			return self().visitMinus(static_cast<MinusNode *>(node), args...);
+		case NodeKind::TIMES:
+			return self().visitTimes(static_cast<TimesNode *>(node), args...);
+		case NodeKind::DIVIDE:
+			return self().visitDivide(static_cast<DivideNode *>(node), args...);
+		case NodeKind::AND:
+			return self().visitAnd(static_cast<AndNode *>(node), args...);
+		case NodeKind::OR:
+			return self().visitOr(static_cast<OrNode *>(node), args...);
+		case NodeKind::EQUALS:
+			return self().visitEquals(static_cast<EqualsNode *>(node), args...);
+		case NodeKind::NOT_EQUALS:
+			return self().visitNotEquals(static_cast<NotEqualsNode *>(node), args...);
+		case NodeKind::LESS:
+			return self().visitLess(static_cast<LessNode *>(node), args...);
+		case NodeKind::GREATER:
+			return self().visitGreater(static_cast<GreaterNode *>(node), args...);
+		case NodeKind::LESS_EQ:
+			return self().visitLessEq(static_cast<LessEqNode *>(node), args...);
+		case NodeKind::GREATER_EQ:
+			return self().visitGreaterEq(static_cast<GreaterEqNode *>(node), args...);
+		}
+		__builtin_unreachable();
+	}
+
+	// Concrete classes, falling back to their base classes
+	Result visitProgram(ProgramNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitDeclList(DeclListNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitVarDecl(VarDeclNode * n, Args... args){ return self().visitDecl(n, args...); }
+	Result visitFnDecl(FnDeclNode * n, Args... args){ return self().visitDecl(n, args...); }
+	Result visitFormalDecl(FormalDeclNode * n, Args... args){ return self().visitDecl(n, args...); }
+	Result visitStructDecl(StructDeclNode * n, Args... args){ return self().visitDecl(n, args...); }
+	Result visitFormalsList(FormalsListNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitFnBody(FnBodyNode * n, Args... args){ return self().visitDecl(n, args...); }
+	Result visitStmtList(StmtListNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitExpList(ExpListNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitInt(IntNode * n, Args... args){ return self().visitType(n, args...); }
+	Result visitBool(BoolNode * n, Args... args){ return self().visitType(n, args...); }
+	Result visitVoid(VoidNode * n, Args... args){ return self().visitType(n, args...); }
+	Result visitStruct(StructNode * n, Args... args){ return self().visitType(n, args...); }
+	Result visitAssignStmt(AssignStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitPostIncStmt(PostIncStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitPostDecStmt(PostDecStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitReadStmt(ReadStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitWriteStmt(WriteStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitIfStmt(IfStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitIfElseStmt(IfElseStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitWhileStmt(WhileStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitCallStmt(CallStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitReturnStmt(ReturnStmtNode * n, Args... args){ return self().visitStmt(n, args...); }
+	Result visitIntLit(IntLitNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitStrLit(StrLitNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitTrue(TrueNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitFalse(FalseNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitId(IdNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitDotAccess(DotAccessNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitAssign(AssignNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitCallExp(CallExpNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitUnaryMinus(UnaryMinusNode * n, Args... args){ return self().visitUnaryExp(n, args...); }
+	Result visitNot(NotNode * n, Args... args){ return self().visitUnaryExp(n, args...); }
+	Result visitPlus(PlusNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitMinus(MinusNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitTimes(TimesNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitDivide(DivideNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitAnd(AndNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitOr(OrNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitEquals(EqualsNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitNotEquals(NotEqualsNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitLess(LessNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitGreater(GreaterNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitLessEq(LessEqNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+	Result visitGreaterEq(GreaterEqNode * n, Args... args){ return self().visitBinaryExp(n, args...); }
+
+	// Abstract classes
+	Result visitDecl(DeclNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitType(TypeNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitStmt(StmtNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitExp(ExpNode * n, Args... args){ return self().visitNode(n, args...); }
+	Result visitUnaryExp(UnaryExpNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitBinaryExp(BinaryExpNode * n, Args... args){ return self().visitExp(n, args...); }
+	Result visitNode(ASTNode *, Args...){ return Result(); }
+private:
+	Derived & self(){ return static_cast<Derived &>(*this); }
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_AST_VISITOR_HPP__ */
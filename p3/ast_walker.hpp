@@ -0,0 +1,344 @@
+#ifndef __LILC_AST_WALKER_HPP__
+#define __LILC_AST_WALKER_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ast.hpp"
+#include "flat_ast.hpp"
+
+namespace LILC{
+
+/*
+The pointer tree seen the way TreeWalker sees a tree: nodes are
+handles with a kind and numbered children. FlatAST offers the same
+interface over NodeIds, so a walker can be written once for both.
+
+Children are numbered in the order their text appears in the source,
+which for a StructDeclNode is its name before its fields. A child can
+be absent (a bare return has no expression); present() says so.
+ */
+class ASTTree{
+	template <typename T, typename F>
+	static void eachOf(NodeArray<T *> items, F & f){
+		for (size_t i = 0; i < items.size(); i++){ f(i, items[i]); }
+	}
+public:
+	typedef ASTNode * Node;
+
+	static NodeKind kind(Node n){ return n->kind(); }
+	static bool present(Node n){ return n != nullptr; }
+	// Calls f(i, child) for each child of n, of kind K, in order
+	template <NodeKind K, typename F>
+	static void forEachChild(Node n, F && f);
+
+	static int intValue(Node n){ return static_cast<IntLitNode *>(n)->value(); }
+	static const char * strText(Node n){ return static_cast<StrLitNode *>(n)->text(); }
+	static size_t strLength(Node n){ return static_cast<StrLitNode *>(n)->length(); }
+	static Atom name(Node n){ return static_cast<IdNode *>(n)->name(); }
+};
+
+// For walkers that don't pass anything down the tree
+struct NoArg{};
+
+/*
+Depth-first traversal of a Tree (ASTTree or FlatAST) that never runs
+out of stack: the top of the tree is walked recursively, which is
+fastest, but below NATIVE_DEPTH levels the walk goes on with a stack of
+its own on the heap, so a tree can be as deep as memory allows; a chain
+of a million additions is as safe to walk as a short one. The heap
+stack is kept between walks.
+
+The walker, Derived, gets three hooks, called statically with the kind
+of n as K:
+
+   pre<K>(n, arg)            before the first child of n
+   beforeChild<K>(n, i, arg) before child i, present or not; returns
+                             the arg child i gets
+   post<K>(n, arg)           after the last child of n
+
+arg is whatever the parent passed n, an indentation for unparse. The
+defaults do nothing and pass arg on unchanged. A hook that switches on
+K is compiled down to its one case, so the walk switches on a node's
+kind just once, as ASTVisitor does. Which stack is in use makes no
+difference to the order the hooks are called in.
+ */
+template <typename Derived, typename Tree, typename Arg = NoArg>
+class TreeWalker{
+public:
+	typedef typename Tree::Node Node;
+
+	// Native frames are small, so this is well under any thread's stack
+	static const unsigned NATIVE_DEPTH = 1024;
+
+	explicit TreeWalker(const Tree & tree) : tree(tree){}
+
+	void walk(Node root, Arg arg = Arg()){
+		descend(root, arg, 0);
+	}
+
+	template <NodeKind K> void pre(Node, Arg){}
+	template <NodeKind K> Arg beforeChild(Node, size_t, Arg arg){ return arg; }
+	template <NodeKind K> void post(Node, Arg){}
+protected:
+	const Tree & tree;
+private:
+	void descend(Node n, Arg arg, unsigned depth){
+		if (depth == NATIVE_DEPTH){
+			walkOnHeap(n, arg);
+			return;
+		}
+		withKind(tree.kind(n), [&](auto k){
+			this->template descendAs<decltype(k)::value>(n, arg, depth);
+		});
+	}
+
+	// One small function per kind, which the switch in descend jumps
+	// to; inlined there, every node would pay for saving the registers
+	// the biggest of them needs
+	template <NodeKind K>
+	__attribute__((noinline)) void descendAs(Node n, Arg arg, unsigned depth){
+		self().template pre<K>(n, arg);
+		tree.template forEachChild<K>(n, [&](size_t i, Node c){
+			Arg childArg = self().template beforeChild<K>(n, i, arg);
+			if (tree.present(c)){
+				descend(c, childArg, depth + 1);
+			}
+		});
+		self().template post<K>(n, arg);
+	}
+
+	// A node whose children are being walked; they are
+	// kids[first, first + count)
+	struct Frame{
+		Node node;
+		uint32_t first;
+		uint32_t next;
+		uint32_t count;
+		Arg arg;
+	};
+
+	__attribute__((noinline)) void walkOnHeap(Node root, Arg arg){
+		// Only ever entered from the bottom of the native walk, so
+		// nothing else is using the stack
+		stack.clear();
+		kids.clear();
+		enter(root, arg);
+		while (!stack.empty()){
+			Frame & top = stack.back();
+			Node n = top.node;
+			if (top.next == top.count){
+				Arg a = top.arg;
+				kids.resize(top.first);
+				stack.pop_back();
+				withKind(tree.kind(n), [&](auto k){
+					self().template post<decltype(k)::value>(n, a);
+				});
+				continue;
+			}
+			size_t i = top.next++;
+			Node c = kids[top.first + i];
+			Arg a = top.arg;
+			Arg childArg = a;
+			withKind(tree.kind(n), [&](auto k){
+				childArg = self().template beforeChild<decltype(k)::value>(n, i, a);
+			});
+			// top is not used again: it moves once something is pushed
+			if (tree.present(c)){
+				enter(c, childArg);
+			}
+		}
+	}
+
+	// Each node's children are fetched once, on the way in; leaves are
+	// done at once, without a frame
+	void enter(Node n, Arg arg){
+		withKind(tree.kind(n), [&](auto k){
+			this->template enterAs<decltype(k)::value>(n, arg);
+		});
+	}
+
+	template <NodeKind K>
+	void enterAs(Node n, Arg arg){
+		self().template pre<K>(n, arg);
+		size_t first = kids.size();
+		tree.template forEachChild<K>(n, [this](size_t, Node c){
+			kids.push_back(c);
+		});
+		if (kids.size() == first){
+			self().template post<K>(n, arg);
+			return;
+		}
+		Frame frame = { n, static_cast<uint32_t>(first), 0,
+			static_cast<uint32_t>(kids.size() - first), arg };
+		stack.push_back(frame);
+	}
+
+	Derived & self(){ return static_cast<Derived &>(*this); }
+
+	std::vector<Frame> stack;
+	std::vector<Node> kids;
+};
+
+template <typename Derived, typename Tree, typename Arg>
+const unsigned TreeWalker<Derived, Tree, Arg>::NATIVE_DEPTH;
+
+template <NodeKind K, typename F>
+inline void ASTTree::forEachChild(Node n, F && f)
+{
+	switch (K){
+	case NodeKind::PROGRAM:
+		f(0, static_cast<ProgramNode *>(n)->declList());
+		break;
+	case NodeKind::DECL_LIST:
+		eachOf(static_cast<DeclListNode *>(n)->decls(), f);
+		break;
+	case NodeKind::FORMALS_LIST:
+		eachOf(static_cast<FormalsListNode *>(n)->formals(), f);
+		break;
+	case NodeKind::STMT_LIST:
+		eachOf(static_cast<StmtListNode *>(n)->stmts(), f);
+		break;
+	case NodeKind::EXP_LIST:
+		eachOf(static_cast<ExpListNode *>(n)->exps(), f);
+		break;
+	case NodeKind::VAR_DECL:
+		{
+		VarDeclNode * d = static_cast<VarDeclNode *>(n);
+		f(0, d->type());
+		f(1, d->id());
+		break;
+		}
+	case NodeKind::FORMAL_DECL:
+		{
+		FormalDeclNode * d = static_cast<FormalDeclNode *>(n);
+		f(0, d->type());
+		f(1, d->id());
+		break;
+		}
+	case NodeKind::FN_DECL:
+		{
+		FnDeclNode * d = static_cast<FnDeclNode *>(n);
+		f(0, d->type());
+		f(1, d->id());
+		f(2, d->formalsList());
+		f(3, d->body());
+		break;
+		}
+	case NodeKind::STRUCT_DECL:
+		{
+		StructDeclNode * d = static_cast<StructDeclNode *>(n);
+		f(0, d->id());
+		f(1, d->declList());
+		break;
+		}
+	case NodeKind::FN_BODY:
+		{
+		FnBodyNode * b = static_cast<FnBodyNode *>(n);
+		f(0, b->declList());
+		f(1, b->stmtList());
+		break;
+		}
+	case NodeKind::STRUCT_TYPE:
+		f(0, static_cast<StructNode *>(n)->id());
+		break;
+	case NodeKind::ASSIGN_STMT:
+		f(0, static_cast<AssignStmtNode *>(n)->assign());
+		break;
+	case NodeKind::POST_INC_STMT:
+		f(0, static_cast<PostIncStmtNode *>(n)->exp());
+		break;
+	case NodeKind::POST_DEC_STMT:
+		f(0, static_cast<PostDecStmtNode *>(n)->exp());
+		break;
+	case NodeKind::READ_STMT:
+		f(0, static_cast<ReadStmtNode *>(n)->exp());
+		break;
+	case NodeKind::WRITE_STMT:
+		f(0, static_cast<WriteStmtNode *>(n)->exp());
+		break;
+	case NodeKind::IF_STMT:
+		{
+		IfStmtNode * s = static_cast<IfStmtNode *>(n);
+		f(0, s->exp());
+		f(1, s->declList());
+		f(2, s->stmtList());
+		break;
+		}
+	case NodeKind::IF_ELSE_STMT:
+		{
+		IfElseStmtNode * s = static_cast<IfElseStmtNode *>(n);
+		f(0, s->exp());
+		f(1, s->declList());
+		f(2, s->stmtList());
+		f(3, s->elseDeclList());
+		f(4, s->elseStmtList());
+		break;
+		}
+	case NodeKind::WHILE_STMT:
+		{
+		WhileStmtNode * s = static_cast<WhileStmtNode *>(n);
+		f(0, s->exp());
+		f(1, s->declList());
+		f(2, s->stmtList());
+		break;
+		}
+	case NodeKind::CALL_STMT:
+		f(0, static_cast<CallStmtNode *>(n)->call());
+		break;
+	case NodeKind::RETURN_STMT:
+		f(0, static_cast<ReturnStmtNode *>(n)->exp());
+		break;
+	case NodeKind::DOT_ACCESS:
+		{
+		DotAccessNode * e = static_cast<DotAccessNode *>(n);
+		f(0, e->exp());
+		f(1, e->id());
+		break;
+		}
+	case NodeKind::ASSIGN:
+		{
+		AssignNode * e = static_cast<AssignNode *>(n);
+		f(0, e->lhs());
+		f(1, e->rhs());
+		break;
+		}
+	case NodeKind::CALL_EXP:
+		{
+		CallExpNode * e = static_cast<CallExpNode *>(n);
+		f(0, e->id());
+		f(1, e->args());
+		break;
+		}
+	case NodeKind::UNARY_MINUS:
+	case NodeKind::NOT:
+		f(0, static_cast<UnaryExpNode *>(n)->exp());
+		break;
+	case NodeKind::PLUS:
+	case NodeKind::MINUS:
+	case NodeKind::TIMES:
+	case NodeKind::DIVIDE:
+	case NodeKind::AND:
+	case NodeKind::OR:
+	case NodeKind::EQUALS:
+	case NodeKind::NOT_EQUALS:
+	case NodeKind::LESS:
+	case NodeKind::GREATER:
+	case NodeKind::LESS_EQ:
+	case NodeKind::GREATER_EQ:
+		{
+		BinaryExpNode * e = static_cast<BinaryExpNode *>(n);
+		f(0, e->lhs());
+		f(1, e->rhs());
+		break;
+		}
+	default:
+		// Leaves
+		break;
+	}
+}
+
+} /* end namespace */
+
+#endif /* END __LILC_AST_WALKER_HPP__ */
@@ -0,0 +1,1153 @@
+/*
+Micro-benchmarks for the Lil' C front end. Each benchmark is a named
+entry in the table at the bottom of this file:
+
+   ./LilCBench <benchmark> [megabytes]
+
+Inputs are synthesized on the fly (a few representative functions
+repeated until the requested size is reached), so no large files need
+to be checked in.
+ */
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include <dirent.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include "../lilc_compiler.hpp"
+#include "../descent_parser.hpp"
+#include "../ast_visitor.hpp"
+#include "../output_buffer.hpp"
+
+// Count every global heap allocation so benchmarks can report them.
+static size_t heapAllocations = 0;
+
+void * operator new(size_t size){
+	heapAllocations++;
+	void * p = std::malloc(size == 0 ? 1 : size);
+	if (p == nullptr){ throw std::bad_alloc(); }
+	return p;
+}
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete(void * p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using TokenTag = LILC::LilC_Parser::token;
+
+double secondsSince(Clock::time_point start){
+	return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Writes roughly megabytes MB of Lil' C to a temporary file and returns
+// its name. Every function gets a distinct name so the program stays
+// valid for later passes.
+std::string generateSource(double megabytes){
+	char name[] = "/tmp/lilc_benchXXXXXX";
+	int fd = mkstemp(name);
+	if (fd < 0){ perror("mkstemp"); exit(EXIT_FAILURE); }
+	close(fd);
+
+	std::ofstream out(name);
+	size_t target = static_cast<size_t>(megabytes * 1024 * 1024);
+	size_t written = 0;
+	out << "struct point {\n  int x;\n  int y;\n};\n";
+	for (int i = 0; written < target; i++){
+		std::string fn =
+		"int func" + std::to_string(i) + "(int a, int b) {\n"
+		"  int x;\n"
+		"  bool done;\n"
+		"  struct point p;\n"
+		"  x = a + b * 10 - (a / 2);\n"
+		"  p.x = x;\n"
+		"  // trailing comment with \"quotes\" and 12345\n"
+		"  while (x < 1000) {\n"
+		"    if (x == a && !done) {\n"
+		"      cout << \"x is \\\"a\\\"\\n\";\n"
+		"    }\n"
+		"    else {\n"
+		"      x = x + 1;\n"
+		"    }\n"
+		"    x++;\n"
+		"  }\n"
+		"  cin >> p.y;\n"
+		"  return x;\n"
+		"}\n";
+		out << fn;
+		written += fn.size();
+	}
+	return name;
+}
+
+void report(const char * what, double seconds, size_t bytes){
+	std::printf("%-28s %8.3f s  %8.1f MB/s\n", what, seconds,
+		bytes / (1024.0 * 1024.0) / seconds);
+}
+
+size_t fileSize(const std::string & name){
+	std::ifstream in(name, std::ios::binary | std::ios::ate);
+	return static_cast<size_t>(in.tellg());
+}
+
+// Scan the input to /dev/null and report heap traffic during the scan.
+int benchTokens(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	size_t heapBefore = heapAllocations;
+	Clock::time_point start = Clock::now();
+	compiler.scan(input.c_str(), "/dev/null");
+	double seconds = secondsSince(start);
+	report("scan", seconds, fileSize(input));
+	std::printf("heap allocations:  %zu\n", heapAllocations - heapBefore);
+	std::printf("arena allocations: %zu in %zu blocks\n",
+		compiler.tokenArena().allocationCount(),
+		compiler.tokenArena().blockCount());
+	return 0;
+}
+
+// Pure tokenizing throughput of each scanner backend over the same
+// memory-mapped input, without writing anything out.
+int benchLexers(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	const LILC::LilC_Scanner::Backend backends[] = {
+		LILC::LilC_Scanner::Backend::FLEX, LILC::LilC_Scanner::Backend::SIMD };
+	const char * names[] = { "flex backend", "simd backend" };
+	for (int i = 0; i < 2; i++){
+		LILC::Arena tokens;
+		LILC::Interner atoms;
+		LILC::LilC_Scanner scanner(tokens, atoms);
+		scanner.scanBuffer(source.data(), source.size());
+		scanner.setBackend(backends[i]);
+		LILC::LilC_Parser::semantic_type lexeme;
+		size_t count = 0;
+		Clock::time_point start = Clock::now();
+		int tag;
+		while ((tag = scanner.yylex(&lexeme)) != LILC::LilC_Parser::token::END){
+			LILC::LilC_Scanner::clearValue(tag, lexeme);
+			count++;
+		}
+		report(names[i], secondsSince(start), source.size());
+		std::printf("   %zu tokens\n", count);
+	}
+	return 0;
+}
+
+// Whole-buffer tokenizing into the token arrays, then draining them
+// the way the parser does, per backend.
+int benchBatch(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	const LILC::LilC_Scanner::Backend backends[] = {
+		LILC::LilC_Scanner::Backend::FLEX, LILC::LilC_Scanner::Backend::SIMD };
+	const char * names[] = { "flex tokenize", "simd tokenize" };
+	for (int i = 0; i < 2; i++){
+		LILC::Arena tokens;
+		LILC::Interner atoms;
+		LILC::LilC_Scanner scanner(tokens, atoms);
+		scanner.scanBuffer(source.data(), source.size());
+		scanner.setBackend(backends[i]);
+		Clock::time_point start = Clock::now();
+		scanner.tokenize();
+		report(names[i], secondsSince(start), source.size());
+		std::printf("   %zu tokens\n", scanner.tokenBuffer().size());
+
+		LILC::LilC_Parser::semantic_type lexeme;
+		start = Clock::now();
+		int tag;
+		while ((tag = scanner.bufferedLex(&lexeme)) != LILC::LilC_Parser::token::END){
+			LILC::LilC_Scanner::clearValue(tag, lexeme);
+		}
+		report("   drain", secondsSince(start), source.size());
+	}
+	return 0;
+}
+
+// Sequential against chunked tokenize with as many threads as the
+// machine has, checking that both give the same token stream.
+int benchParallel(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner sequential(tokens, atoms);
+	sequential.scanBuffer(source.data(), source.size());
+	sequential.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	Clock::time_point start = Clock::now();
+	sequential.tokenize();
+	report("1 thread", secondsSince(start), source.size());
+
+	LILC::ThreadPool pool(LILC::ThreadPool::hardwareThreads());
+	LILC::LilC_Scanner chunked(tokens, atoms);
+	chunked.scanBuffer(source.data(), source.size());
+	chunked.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	start = Clock::now();
+	chunked.tokenizeParallel(pool);
+	std::string label = std::to_string(pool.size()) + " thread(s)";
+	report(label.c_str(), secondsSince(start), source.size());
+
+	const LILC::TokenBuffer & a = sequential.tokenBuffer();
+	const LILC::TokenBuffer & b = chunked.tokenBuffer();
+	if (a.tags != b.tags || a.starts != b.starts || a.lengths != b.lengths){
+		std::printf("token streams differ\n");
+		return 1;
+	}
+	std::printf("   %zu tokens, identical\n", a.size());
+	return 0;
+}
+
+// Writing the scan output for an already tokenized input: the old
+// stream-and-endl-per-token way against TokenDump's text and binary
+// formats. Run with 100 (MB) or so for a realistic dump.
+int benchDump(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.scanBuffer(source.data(), source.size());
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.tokenize();
+	const LILC::TokenBuffer & buffer = scanner.tokenBuffer();
+	std::string output = input + ".tokens";
+
+	Clock::time_point start = Clock::now();
+	{
+		std::ofstream out(output);
+		for (size_t i = 0; i < buffer.size(); i++){
+			int tag = buffer.tags[i];
+			const char * text = source.data() + buffer.starts[i];
+			out << LILC::TOKEN_SPELLINGS.text[tag];
+			if (tag == TokenTag::INTLITERAL){
+				bool overflow;
+				out << LILC::decodeIntLit(text,
+					buffer.lengths[i], overflow);
+			} else if (tag == TokenTag::ID || tag == TokenTag::STRINGLITERAL){
+				out << std::string(text, buffer.lengths[i]);
+			}
+			out << std::endl;
+		}
+	}
+	report("ostream, endl per token", secondsSince(start), source.size());
+	std::printf("   %zu bytes out\n", fileSize(output));
+
+	const LILC::TokenDump::Format formats[] = {
+		LILC::TokenDump::Format::TEXT, LILC::TokenDump::Format::BINARY };
+	const char * names[] = { "TokenDump text", "TokenDump binary" };
+	for (int f = 0; f < 2; f++){
+		start = Clock::now();
+		{
+			std::ofstream out(output, std::ios::binary);
+			LILC::TokenDump dump(out, formats[f]);
+			for (size_t i = 0; i < buffer.size(); i++){
+				int tag = buffer.tags[i];
+				const char * text = source.data() + buffer.starts[i];
+				size_t length = buffer.lengths[i];
+				switch (tag){
+				case TokenTag::ID: dump.id(text, length); break;
+				case TokenTag::STRINGLITERAL: dump.stringLit(text, length); break;
+				case TokenTag::INTLITERAL: {
+					bool overflow;
+					dump.intLit(LILC::decodeIntLit(text,
+						length, overflow));
+					break;
+				}
+				default: dump.token(tag); break;
+				}
+			}
+		}
+		report(names[f], secondsSince(start), source.size());
+		std::printf("   %zu bytes out\n", fileSize(output));
+	}
+	std::remove(output.c_str());
+	return 0;
+}
+
+// Editing: small random edits each followed by relex, against lexing
+// the whole file again, and a check that the result still matches.
+int benchRelex(const std::string & input){
+	std::ifstream in(input);
+	std::string text((std::istreambuf_iterator<char>(in)),
+		std::istreambuf_iterator<char>());
+	std::string buffer = text + std::string(LILC::SourceBuffer::PADDING, '\0');
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.scanBuffer(&buffer[0], text.size());
+	Clock::time_point start = Clock::now();
+	scanner.tokenize();
+	double full = secondsSince(start);
+	report("full tokenize", full, text.size());
+
+	// Whole statements typed in at the start of a line, so the edits
+	// never cut a string literal and end the scan early. Like someone
+	// editing, they come in bursts near one place in the file; jumping
+	// elsewhere costs relex time in proportion to the distance, once.
+	const char * edits[] = { "y = y + 1;\n", "// note\n", "\n",
+		"cout << \"typed\";\n" };
+	const int EDITS = 1000;
+	unsigned seed = 665;
+	size_t spot = 0;
+	double relexing = 0;
+	for (int i = 0; i < EDITS; i++){
+		seed = seed * 1103515245 + 12345;
+		if (i % 100 == 0){
+			spot = seed % text.size();
+		}
+		size_t offset = std::min(spot + (seed >> 20) % 4096, text.size());
+		while (offset > 0 && text[offset - 1] != '\n'){ offset--; }
+		size_t removed = 0;
+		std::string inserted = edits[(seed >> 16) % 4];
+		text.replace(offset, removed, inserted);
+		buffer = text + std::string(LILC::SourceBuffer::PADDING, '\0');
+		start = Clock::now();
+		scanner.relex(&buffer[0], text.size(), offset, removed, inserted.size());
+		relexing += secondsSince(start);
+	}
+	std::printf("%-28s %8.1f us  (full tokenize %.1f us)\n", "relex, per edit",
+		relexing / EDITS * 1e6, full * 1e6);
+
+	LILC::LilC_Scanner fresh(tokens, atoms);
+	fresh.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	fresh.scanBuffer(&buffer[0], text.size());
+	fresh.tokenize();
+	const LILC::TokenBuffer & a = scanner.tokenBuffer();
+	const LILC::TokenBuffer & b = fresh.tokenBuffer();
+	if (a.tags != b.tags || a.starts != b.starts || a.lengths != b.lengths){
+		std::printf("relexed stream differs from a full tokenize\n");
+		return 1;
+	}
+	std::printf("   %zu tokens after %d edits, identical\n", a.size(), EDITS);
+	return 0;
+}
+
+// Locations: building the line table, then turning a SourceLoc into
+// a line and column for every token, as a diagnostic per token would.
+int benchLines(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.scanBuffer(source.data(), source.size());
+	scanner.tokenize();
+	const LILC::TokenBuffer & buffer = scanner.tokenBuffer();
+
+	LILC::LineTable table;
+	Clock::time_point start = Clock::now();
+	table.build(source.data(), source.size());
+	report("build line table", secondsSince(start), source.size());
+	std::printf("   %zu lines\n", table.lineCount());
+
+	uint64_t sum = 0;
+	start = Clock::now();
+	for (size_t i = 0; i < buffer.size(); i++){
+		LILC::LineColumn at = table.position(LILC::SourceLoc(buffer.starts[i]));
+		sum += at.line + at.column;
+	}
+	double seconds = secondsSince(start);
+	std::printf("%-28s %8.1f ns  (checksum %llu)\n", "position, per token",
+		seconds * 1e9 / buffer.size(), static_cast<unsigned long long>(sum));
+	return 0;
+}
+
+// Literal-heavy input: scanning it (with semantic values, as the parser
+// gets them) should neither parse floats nor touch the heap; decoding
+// happens separately, only for the literals asked about. The old way of
+// converting every literal while scanning is timed for comparison.
+int benchLiterals(const std::string & input){
+	size_t target = fileSize(input);
+	std::string text;
+	for (int i = 0; text.size() < target; i++){
+		text += "x = " + std::to_string(i * 7919) + " + 2147483647 * "
+			+ std::to_string(i) + ";\n"
+			"cout << \"line \\\"" + std::to_string(i) + "\\\"\\t\\n\";\n";
+	}
+	std::string buffer = text + std::string(LILC::SourceBuffer::PADDING, '\0');
+	std::ostringstream sink;
+
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.setDiagnostics(sink);
+	scanner.scanBuffer(&buffer[0], text.size());
+	std::vector<LILC::SynSymbol *> literals;
+	literals.reserve(text.size() / 8);
+	LILC::LilC_Parser::semantic_type lexeme;
+	size_t heapBefore = heapAllocations;
+	Clock::time_point start = Clock::now();
+	int tag;
+	while ((tag = scanner.yylex(&lexeme)) != TokenTag::END){
+		if (tag == TokenTag::INTLITERAL){
+			literals.push_back(lexeme.as<LILC::IntLitToken *>());
+		} else if (tag == TokenTag::STRINGLITERAL){
+			literals.push_back(lexeme.as<LILC::StringLitToken *>());
+		}
+		LILC::LilC_Scanner::clearValue(tag, lexeme);
+	}
+	report("scan, spans only", secondsSince(start), text.size());
+	std::printf("   %zu literals, %zu heap allocations\n", literals.size(),
+		heapAllocations - heapBefore);
+
+	LILC::Arena decoded;
+	uint64_t sum = 0;
+	heapBefore = heapAllocations;
+	start = Clock::now();
+	for (LILC::SynSymbol * literal : literals){
+		if (literal->tag() == TokenTag::INTLITERAL){
+			sum += static_cast<LILC::IntLitToken *>(literal)->value();
+		} else {
+			size_t length;
+			static_cast<LILC::StringLitToken *>(literal)->decode(decoded, length);
+			sum += length;
+		}
+	}
+	report("decode every literal", secondsSince(start), text.size());
+	std::printf("   %zu heap allocations (checksum %llu)\n",
+		heapAllocations - heapBefore, static_cast<unsigned long long>(sum));
+
+	// stod and atoi for each int, a std::string copy for each string
+	sum = 0;
+	heapBefore = heapAllocations;
+	start = Clock::now();
+	for (LILC::SynSymbol * literal : literals){
+		if (literal->tag() == TokenTag::INTLITERAL){
+			LILC::IntLitToken * token = static_cast<LILC::IntLitToken *>(literal);
+			std::string digits(text, token->loc().offset,
+				std::strspn(&text[token->loc().offset], "0123456789"));
+			double value = std::stod(digits);
+			sum += value > INT_MAX ? INT_MAX : std::atoi(digits.c_str());
+		} else {
+			LILC::StringLitToken * token = static_cast<LILC::StringLitToken *>(literal);
+			std::string copy(token->text(), token->length());
+			sum += copy.size();
+		}
+	}
+	report("stod/atoi/std::string", secondsSince(start), text.size());
+	std::printf("   %zu heap allocations\n", heapAllocations - heapBefore);
+	return 0;
+}
+
+// Resident set size right now, from /proc/self/statm
+size_t residentBytes(){
+	std::ifstream statm("/proc/self/statm");
+	size_t total = 0, resident = 0;
+	statm >> total >> resident;
+	return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+// Parsing the same input again and again in one compiler, as a long
+// running process would: time and memory per compilation. Memory should
+// stay flat, as each compilation releases the one before it.
+int benchParse(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	for (int round = 1; round <= 5; round++){
+		size_t heapBefore = heapAllocations;
+		Clock::time_point start = Clock::now();
+		compiler.parse(input.c_str(), "/dev/null");
+		std::string label = "parse, round " + std::to_string(round);
+		report(label.c_str(), secondsSince(start), fileSize(input));
+		std::printf("   %zu heap allocations, %zu arena blocks, RSS %.1f MB\n",
+			heapAllocations - heapBefore, compiler.astArena().blockCount(),
+			residentBytes() / (1024.0 * 1024.0));
+	}
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	std::printf("peak RSS %.1f MB\n", usage.ru_maxrss / 1024.0);
+	return 0;
+}
+
+// Discards what is written to it, so unparse is timed without I/O
+class NullBuffer : public std::streambuf{
+protected:
+	std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+	int overflow(int c) override { return c; }
+};
+
+// Large function bodies: building their statement lists while parsing,
+// then walking them (by unparsing to nowhere) a few times.
+int benchTraverse(const std::string & input){
+	char name[] = "/tmp/lilc_bodiesXXXXXX";
+	int fd = mkstemp(name);
+	if (fd < 0){ perror("mkstemp"); return 1; }
+	close(fd);
+	size_t target = fileSize(input);
+	{
+		std::ofstream out(name);
+		size_t written = 0;
+		for (int f = 0; written < target; f++){
+			std::string head = "int body" + std::to_string(f) + "(int a) {\n  int x;\n";
+			out << head;
+			written += head.size();
+			for (int i = 0; i < 100000; i++){
+				const char * stmt = i % 2 ? "  x = x + a;\n" : "  x++;\n";
+				out << stmt;
+				written += std::strlen(stmt);
+			}
+			out << "  return x;\n}\n";
+		}
+	}
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	Clock::time_point start = Clock::now();
+	compiler.parse(name, "/dev/null");
+	report("parse", secondsSince(start), target);
+
+	NullBuffer nothing;
+	std::ostream out(&nothing);
+	const int WALKS = 5;
+	start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		compiler.getASTRoot()->unparse(out, 0);
+	}
+	report("unparse, per walk", secondsSince(start) / WALKS, target);
+	std::remove(name);
+	return 0;
+}
+
+// The pointer tree and the flat arrays of the same program: memory per
+// node, and how long an unparse to nowhere takes from each. The tree's
+// memory is its whole arena, list arrays left behind as they grew
+// included; the flat form's is the capacity of its arrays.
+int benchFlat(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	compiler.parse(input.c_str(), "/dev/null");
+	LILC::ProgramNode * root = compiler.getASTRoot();
+
+	LILC::FlatAST flat;
+	Clock::time_point start = Clock::now();
+	flat.reserve(compiler.astArena().allocationCount());
+	root->flatten(flat);
+	report("flatten", secondsSince(start), fileSize(input));
+
+	double count = static_cast<double>(flat.size());
+	size_t treeBytes = compiler.astArena().footprint();
+	size_t flatBytes = flat.footprint();
+	std::printf("%zu nodes\n", flat.size());
+	std::printf("tree: %8.1f MB  %5.1f bytes/node\n",
+		treeBytes / (1024.0 * 1024.0), treeBytes / count);
+	std::printf("flat: %8.1f MB  %5.1f bytes/node\n",
+		flatBytes / (1024.0 * 1024.0), flatBytes / count);
+	// --ast=flat builds the tree and flattens it before releasing it,
+	// so for a moment it holds both
+	std::printf("peak, --ast=flat: %8.1f MB  tree and flat at once, "
+		"%.2fx the tree alone\n",
+		(treeBytes + flatBytes) / (1024.0 * 1024.0),
+		static_cast<double>(treeBytes + flatBytes) / treeBytes);
+
+	NullBuffer nothing;
+	std::ostream out(&nothing);
+	const int WALKS = 5;
+	start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		root->unparse(out, 0);
+	}
+	report("unparse tree, per walk", secondsSince(start) / WALKS, fileSize(input));
+	start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		flat.unparse(out);
+	}
+	report("unparse flat, per walk", secondsSince(start) / WALKS, fileSize(input));
+	return 0;
+}
+
+// Counts nodes: a pass that does next to nothing per node, so what it
+// costs is mostly getting from one node to the next
+class NodeCounter : public LILC::ASTVisitor<NodeCounter, size_t>{
+public:
+	size_t visitProgram(LILC::ProgramNode * n){ return 1 + visit(n->declList()); }
+	size_t visitDeclList(LILC::DeclListNode * n){ return 1 + all(n->decls()); }
+	size_t visitFormalsList(LILC::FormalsListNode * n){ return 1 + all(n->formals()); }
+	size_t visitStmtList(LILC::StmtListNode * n){ return 1 + all(n->stmts()); }
+	size_t visitExpList(LILC::ExpListNode * n){ return 1 + all(n->exps()); }
+	size_t visitFnDecl(LILC::FnDeclNode * n){
+		return 1 + visit(n->type()) + visit(n->id())
+			+ visit(n->formalsList()) + visit(n->body());
+	}
+	size_t visitFormalDecl(LILC::FormalDeclNode * n){
+		return 1 + visit(n->type()) + visit(n->id());
+	}
+	size_t visitVarDecl(LILC::VarDeclNode * n){
+		return 1 + visit(n->type()) + visit(n->id());
+	}
+	size_t visitFnBody(LILC::FnBodyNode * n){
+		return 1 + visit(n->declList()) + visit(n->stmtList());
+	}
+	size_t visitAssignStmt(LILC::AssignStmtNode * n){ return 1 + visit(n->assign()); }
+	size_t visitReturnStmt(LILC::ReturnStmtNode * n){ return 1 + visit(n->exp()); }
+	size_t visitAssign(LILC::AssignNode * n){ return 1 + visit(n->lhs()) + visit(n->rhs()); }
+	size_t visitBinaryExp(LILC::BinaryExpNode * n){ return 1 + visit(n->lhs()) + visit(n->rhs()); }
+	size_t visitUnaryExp(LILC::UnaryExpNode * n){ return 1 + visit(n->exp()); }
+	size_t visitNode(LILC::ASTNode *){ return 1; }
+private:
+	template <typename T>
+	size_t all(LILC::NodeArray<T *> items){
+		size_t count = 0;
+		for (T * item : items){ count += visit(item); }
+		return count;
+	}
+};
+
+// Deep expression trees: every statement assigns a long chain of
+// binary operators, so almost all nodes are expressions and walks
+// spend their time dispatching on them
+int benchDispatch(const std::string & input){
+	char name[] = "/tmp/lilc_deepXXXXXX";
+	int fd = mkstemp(name);
+	if (fd < 0){ perror("mkstemp"); return 1; }
+	close(fd);
+	size_t target = fileSize(input);
+	{
+		static const char * const ops[] = { " + ", " * ", " - ", " / ", " && ", " || " };
+		std::ofstream out(name);
+		size_t written = 0;
+		for (int f = 0; written < target; f++){
+			std::string fn = "int deep" + std::to_string(f) + "(int a, int b) {\n  int x;\n";
+			for (int stmt = 0; stmt < 20; stmt++){
+				fn += "  x = a";
+				for (int i = 0; i < 500; i++){
+					fn += ops[(i + stmt) % 6];
+					fn += i % 2 ? "b" : "-a";
+				}
+				fn += ";\n";
+			}
+			fn += "  return x;\n}\n";
+			out << fn;
+			written += fn.size();
+		}
+	}
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	Clock::time_point start = Clock::now();
+	compiler.parse(name, "/dev/null");
+	report("parse", secondsSince(start), target);
+	LILC::ProgramNode * root = compiler.getASTRoot();
+
+	const int WALKS = 5;
+	size_t count = 0;
+	start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		count = NodeCounter().visit(root);
+	}
+	double seconds = secondsSince(start) / WALKS;
+	report("count nodes, per walk", seconds, target);
+	std::printf("   %zu nodes, %.2f ns per node\n", count, seconds * 1e9 / count);
+
+	NullBuffer nothing;
+	std::ostream out(&nothing);
+	start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		root->unparse(out, 0);
+	}
+	seconds = secondsSince(start) / WALKS;
+	report("unparse, per walk", seconds, target);
+	std::printf("   %.2f ns per node\n", seconds * 1e9 / count);
+	std::remove(name);
+	return 0;
+}
+
+// One expression as long as the input: a left-deep chain of additions
+// nested once per operator, far deeper than the native stack could
+// walk recursively
+int benchDepth(const std::string & input){
+	char name[] = "/tmp/lilc_chainXXXXXX";
+	int fd = mkstemp(name);
+	if (fd < 0){ perror("mkstemp"); return 1; }
+	close(fd);
+	size_t target = fileSize(input);
+	size_t operators = 0;
+	{
+		std::ofstream out(name);
+		out << "int chain(int a) {\n  int x;\n  x = a";
+		for (size_t written = 0; written < target; written += 4){
+			out << " + a";
+			operators++;
+		}
+		out << ";\n  return x;\n}\n";
+	}
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	Clock::time_point start = Clock::now();
+	compiler.parse(name, "/dev/null");
+	report("parse", secondsSince(start), target);
+	std::printf("   %zu operators deep\n", operators);
+	LILC::ProgramNode * root = compiler.getASTRoot();
+
+	NullBuffer nothing;
+	std::ostream out(&nothing);
+	start = Clock::now();
+	root->unparse(out, 0);
+	report("unparse tree", secondsSince(start), target);
+
+	LILC::FlatAST flat;
+	start = Clock::now();
+	root->flatten(flat);
+	report("flatten", secondsSince(start), target);
+	start = Clock::now();
+	flat.unparse(out);
+	report("unparse flat", secondsSince(start), target);
+	std::remove(name);
+	return 0;
+}
+
+// Parsing with and without structural hashes, best of a few rounds
+// each, and how many of the input's functions hash the same; the
+// generated ones differ only in name, so they should all share one
+int benchHash(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	double best[2] = { 1e9, 1e9 };
+	for (int round = 0; round < 6; round++){
+		bool hashing = round % 2 == 1;
+		compiler.setHashing(hashing);
+		Clock::time_point start = Clock::now();
+		compiler.parse(input.c_str(), "/dev/null");
+		best[hashing] = std::min(best[hashing], secondsSince(start));
+	}
+	report("parse", best[0], fileSize(input));
+	report("parse and hash", best[1], fileSize(input));
+	std::printf("   hashing %+.1f%%\n", 100 * (best[1] - best[0]) / best[0]);
+	// The same on its own, which is steadier than the difference
+	LILC::ProgramNode * root = compiler.getASTRoot();
+	const int WALKS = 5;
+	Clock::time_point start = Clock::now();
+	for (int i = 0; i < WALKS; i++){
+		root->structuralHash();
+	}
+	double seconds = secondsSince(start) / WALKS;
+	report("hash, per walk", seconds, fileSize(input));
+	std::printf("   %.1f%% of parse\n", 100 * seconds / best[0]);
+
+	size_t functions = 0;
+	std::unordered_set<uint64_t> distinct;
+	for (LILC::DeclNode * decl : root->declList()->decls()){
+		if (decl->kind() == LILC::NodeKind::FN_DECL){
+			functions++;
+			distinct.insert(static_cast<LILC::FnDeclNode *>(decl)->hash());
+		}
+	}
+	std::printf("%zu functions, %zu distinct\n", functions, distinct.size());
+	return 0;
+}
+
+int benchShare(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	compiler.setHashing(false);
+	const char * modes[] = { "parse", "parse, sharing" };
+	std::string unparsed[2];
+	for (int sharing = 0; sharing < 2; sharing++){
+		compiler.setSharedExps(sharing == 1);
+		double best = 1e9;
+		for (int round = 0; round < 3; round++){
+			Clock::time_point start = Clock::now();
+			compiler.parse(input.c_str(), "/dev/null");
+			best = std::min(best, secondsSince(start));
+		}
+		report(modes[sharing], best, fileSize(input));
+		std::printf("   %zu arena allocations, %.1f MB\n",
+			compiler.astArena().allocationCount(),
+			compiler.astArena().footprint() / (1024.0 * 1024.0));
+		std::ostringstream out;
+		compiler.getASTRoot()->unparse(out, 0);
+		unparsed[sharing] = out.str();
+	}
+	const LILC::ExpTable & exps = compiler.expTable();
+	std::printf("%zu shared expressions, %zu makes answered by them\n",
+		exps.size(), exps.reused());
+	std::printf("unparse %s\n",
+		unparsed[0] == unparsed[1] ? "identical" : "DIFFERS");
+	return unparsed[0] == unparsed[1] ? 0 : 1;
+}
+
+// Parse from scratch, then with an image cache: the first parse saves
+// the image, the ones after it only load it
+int benchCache(const std::string & input){
+	char dir[] = "/tmp/lilc_cacheXXXXXX";
+	if (mkdtemp(dir) == nullptr){ perror("mkdtemp"); return 1; }
+	std::string cold = input + ".cold", warm = input + ".warm";
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+
+	double best = 1e9;
+	for (int round = 0; round < 3; round++){
+		Clock::time_point start = Clock::now();
+		compiler.parse(input.c_str(), cold.c_str());
+		best = std::min(best, secondsSince(start));
+	}
+	report("parse", best, fileSize(input));
+
+	compiler.setCacheDir(dir);
+	Clock::time_point start = Clock::now();
+	compiler.parse(input.c_str(), "/dev/null");
+	report("parse, saving image", secondsSince(start), fileSize(input));
+	best = 1e9;
+	for (int round = 0; round < 3; round++){
+		start = Clock::now();
+		compiler.parse(input.c_str(), warm.c_str());
+		best = std::min(best, secondsSince(start));
+	}
+	report("load image", best, fileSize(input));
+	bool loaded = compiler.cachedAST().loaded();
+
+	size_t imageBytes = 0;
+	if (DIR * d = opendir(dir)){
+		while (dirent * e = readdir(d)){
+			if (e->d_name[0] == '.'){ continue; }
+			std::string name = std::string(dir) + "/" + e->d_name;
+			imageBytes += fileSize(name);
+			std::remove(name.c_str());
+		}
+		closedir(d);
+	}
+	rmdir(dir);
+	std::printf("image: %.1f MB for %.1f MB of source\n",
+		imageBytes / (1024.0 * 1024.0), fileSize(input) / (1024.0 * 1024.0));
+
+	std::ifstream a(cold, std::ios::binary), b(warm, std::ios::binary);
+	bool same = std::equal(std::istreambuf_iterator<char>(a),
+		std::istreambuf_iterator<char>(), std::istreambuf_iterator<char>(b),
+		std::istreambuf_iterator<char>());
+	std::remove(cold.c_str());
+	std::remove(warm.c_str());
+	std::printf("%s, unparse %s\n", loaded ? "loaded" : "NOT LOADED",
+		same ? "identical" : "DIFFERS");
+	return loaded && same ? 0 : 1;
+}
+
+// Unparse one tree to a file on 1, 2, 4, ... threads, up to the
+// machine's, checking every output against the sequential one
+int benchUnparse(const std::string & input){
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	compiler.parse(input.c_str(), "/dev/null");
+	LILC::ProgramNode * root = compiler.getASTRoot();
+	std::string reference = input + ".1", output = input + ".n";
+
+	double base = 1e9;
+	for (int round = 0; round < 3; round++){
+		Clock::time_point start = Clock::now();
+		std::ofstream out(reference);
+		root->unparse(out);
+		out.close();
+		base = std::min(base, secondsSince(start));
+	}
+	report("sequential", base, fileSize(input));
+
+	int status = 0;
+	size_t most = std::max<size_t>(2, LILC::ThreadPool::hardwareThreads());
+	for (size_t threads = 2; threads <= most; threads *= 2){
+		LILC::ThreadPool pool(threads);
+		double best = 1e9;
+		for (int round = 0; round < 3; round++){
+			Clock::time_point start = Clock::now();
+			std::vector<LILC::OutputBuffer> parts;
+			root->unparse(pool, parts);
+			LILC::OutputBuffer::writeAll(output.c_str(), parts);
+			best = std::min(best, secondsSince(start));
+		}
+		std::string label = std::to_string(threads) + " threads";
+		report(label.c_str(), best, fileSize(input));
+		std::ifstream a(reference, std::ios::binary), b(output, std::ios::binary);
+		bool same = std::equal(std::istreambuf_iterator<char>(a),
+			std::istreambuf_iterator<char>(), std::istreambuf_iterator<char>(b),
+			std::istreambuf_iterator<char>());
+		std::printf("   %.2fx, %s\n", base / best, same ? "identical" : "DIFFERS");
+		status |= same ? 0 : 1;
+	}
+	std::remove(reference.c_str());
+	std::remove(output.c_str());
+	return status;
+}
+
+// Lex, parse and unparse with the parse on 1, 2, 4, ... threads, up
+// to the machine's, checking every output against the sequential one.
+// Lexing and unparsing stay on one thread, so only the parse differs.
+int benchSplit(const std::string & input){
+	std::string reference = input + ".1", output = input + ".n";
+	double base = 0;
+	int status = 0;
+	size_t most = std::max<size_t>(2, LILC::ThreadPool::hardwareThreads());
+	for (size_t threads = 1; threads <= most; threads *= 2){
+		LILC::LilC_Compiler compiler;
+		compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+		compiler.setParseThreads(threads);
+		double best = 1e9;
+		for (int round = 0; round < 3; round++){
+			Clock::time_point start = Clock::now();
+			compiler.parse(input.c_str(), "/dev/null");
+			best = std::min(best, secondsSince(start));
+		}
+		std::string label = std::to_string(threads)
+			+ (threads == 1 ? " thread" : " threads");
+		report(label.c_str(), best, fileSize(input));
+		if (threads == 1){
+			base = best;
+			compiler.parse(input.c_str(), reference.c_str());
+			continue;
+		}
+		compiler.parse(input.c_str(), output.c_str());
+		std::ifstream a(reference, std::ios::binary), b(output, std::ios::binary);
+		bool same = std::equal(std::istreambuf_iterator<char>(a),
+			std::istreambuf_iterator<char>(), std::istreambuf_iterator<char>(b),
+			std::istreambuf_iterator<char>());
+		std::printf("   %.2fx, %s\n", base / best, same ? "identical" : "DIFFERS");
+		status |= same ? 0 : 1;
+	}
+	std::remove(reference.c_str());
+	std::remove(output.c_str());
+	return status;
+}
+
+// One-line edits inside functions, each followed by a reparse, against
+// parsing the whole file. Afterwards the tree must match a fresh parse
+// of the edited text: same unparse, same locations, same hashes.
+int benchReparse(const std::string & input){
+	std::ifstream in(input);
+	std::string text((std::istreambuf_iterator<char>(in)),
+		std::istreambuf_iterator<char>());
+	LILC::LilC_Compiler compiler;
+	compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	Clock::time_point start = Clock::now();
+	compiler.parse(input.c_str(), "/dev/null");
+	double full = secondsSince(start);
+	report("full parse", full, text.size());
+
+	// Statements typed in or changed in place, in bursts near one
+	// spot as someone editing would
+	const int EDITS = 1000;
+	unsigned seed = 665;
+	size_t spot = 0;
+	double reparsing = 0;
+	bool parsed = true;
+	for (int i = 0; i < EDITS && parsed; i++){
+		seed = seed * 1103515245 + 12345;
+		if (i % 100 == 0){
+			spot = seed % text.size();
+		}
+		size_t from = std::min(spot + (seed >> 20) % 4096, text.size());
+		size_t offset, removed;
+		std::string inserted;
+		if ((seed >> 16) % 2 == 0){
+			offset = text.find("    x++;\n", from);
+			removed = 0;
+			inserted = "    x++;\n";
+		} else {
+			offset = text.find("x + 1;", from);
+			removed = 5;
+			inserted = (seed >> 17) % 2 ? "x - 7" : "x + 1";
+		}
+		if (offset == std::string::npos){
+			spot = 0;
+			continue;
+		}
+		text.replace(offset, removed, inserted);
+		start = Clock::now();
+		parsed = compiler.reparse(offset, removed, inserted.data(),
+			inserted.size());
+		reparsing += secondsSince(start);
+	}
+	std::printf("%-28s %8.1f us  (full parse %.1f us)\n", "reparse, per edit",
+		reparsing / EDITS * 1e6, full * 1e6);
+
+	std::string edited = input + ".edited";
+	std::ofstream(edited, std::ios::binary) << text;
+	LILC::LilC_Compiler fresh;
+	fresh.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+	fresh.parse(edited.c_str(), "/dev/null");
+	std::remove(edited.c_str());
+	LILC::ProgramNode * a = compiler.getASTRoot();
+	LILC::ProgramNode * b = fresh.getASTRoot();
+	if (!parsed || a == nullptr || b == nullptr){
+		std::printf("edited source didn't parse\n");
+		return 1;
+	}
+	std::ostringstream textA, textB;
+	a->unparse(textA);
+	b->unparse(textB);
+	LILC::FlatAST flatA, flatB;
+	a->flatten(flatA);
+	b->flatten(flatB);
+	bool same = textA.str() == textB.str() && flatA.size() == flatB.size();
+	for (size_t n = 0; same && n < flatA.size(); n++){
+		same = flatA.kind(n) == flatB.kind(n) && flatA.loc(n) == flatB.loc(n);
+	}
+	LILC::NodeArray<LILC::DeclNode *> declsA = a->declList()->decls();
+	LILC::NodeArray<LILC::DeclNode *> declsB = b->declList()->decls();
+	for (size_t i = 0; same && i < declsA.size(); i++){
+		if (declsA[i]->kind() == LILC::NodeKind::FN_DECL){
+			same = static_cast<LILC::FnDeclNode *>(declsA[i])->hash()
+				== static_cast<LILC::FnDeclNode *>(declsB[i])->hash();
+		}
+	}
+	std::printf("   tree after %d edits %s a fresh parse\n", EDITS,
+		same ? "identical to" : "DIFFERS from");
+	return same ? 0 : 1;
+}
+
+// Lex everything then parse, against lexing on a second thread while
+// parsing; both unparse to the same file on one thread afterwards
+int benchPipeline(const std::string & input){
+	std::string reference = input + ".1", output = input + ".p";
+	double times[2];
+	for (int pipelined = 0; pipelined < 2; pipelined++){
+		LILC::LilC_Compiler compiler;
+		compiler.setLexer(LILC::LilC_Scanner::Backend::SIMD);
+		compiler.setPipelined(pipelined == 1);
+		double best = 1e9;
+		for (int round = 0; round < 3; round++){
+			Clock::time_point start = Clock::now();
+			compiler.parse(input.c_str(), "/dev/null");
+			best = std::min(best, secondsSince(start));
+		}
+		times[pipelined] = best;
+		report(pipelined ? "pipelined" : "lex, then parse", best, fileSize(input));
+		compiler.parse(input.c_str(), (pipelined ? output : reference).c_str());
+	}
+	std::ifstream a(reference, std::ios::binary), b(output, std::ios::binary);
+	bool same = std::equal(std::istreambuf_iterator<char>(a),
+		std::istreambuf_iterator<char>(), std::istreambuf_iterator<char>(b),
+		std::istreambuf_iterator<char>());
+	std::remove(reference.c_str());
+	std::remove(output.c_str());
+	std::printf("   %.2fx, %s\n", times[0] / times[1], same ? "identical" : "DIFFERS");
+
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.scanBuffer(source.data(), source.size());
+	scanner.tokenize();
+	const size_t perToken = sizeof(uint16_t) + 2 * sizeof(uint32_t);
+	size_t inFlight = (LILC::TokenRing::SLOTS + 1) * LILC::TokenRing::BATCH;
+	std::printf("tokens held: %zu (%.1f MB) lexed first, at most %zu (%.1f MB) pipelined\n",
+		scanner.tokenBuffer().size(),
+		scanner.tokenBuffer().size() * perToken / (1024.0 * 1024.0),
+		inFlight, inFlight * perToken / (1024.0 * 1024.0));
+	return same ? 0 : 1;
+}
+
+// Parse a stream lexed once with each parser backend, so the times are
+// the parsers' alone; each parse starts on fresh arenas, as a
+// compiler's does
+int benchParsers(const std::string & input){
+	LILC::SourceBuffer source;
+	if (!source.map(input.c_str())){ return 1; }
+	LILC::Arena tokens;
+	LILC::Interner atoms;
+	LILC::LilC_Scanner scanner(tokens, atoms);
+	scanner.setBackend(LILC::LilC_Scanner::Backend::SIMD);
+	scanner.scanBuffer(source.data(), source.size());
+	scanner.tokenize();
+	const size_t count = scanner.tokenCount();
+
+	const char * names[2] = { "bison (LALR tables)", "recursive descent" };
+	std::string unparsed[2];
+	double times[2];
+	for (int descent = 0; descent < 2; descent++){
+		double best = 1e9;
+		for (int round = 0; round < 3; round++){
+			LILC::Arena partTokens, nodes;
+			LILC::ExpTable exps(nodes);
+			LILC::LilC_Scanner part(partTokens, atoms);
+			part.followTokens(scanner, 0, count - 1, nullptr);
+			LILC::ProgramNode * root = nullptr;
+			Clock::time_point start = Clock::now();
+			bool parsed;
+			if (descent){
+				LILC::DescentParser parser(part, root, nodes, exps);
+				parsed = parser.parse() == 0;
+			} else {
+				LILC::LilC_Parser parser(part, root, nodes, exps);
+				parsed = parser.parse() == 0;
+			}
+			best = std::min(best, secondsSince(start));
+			if (!parsed){
+				std::printf("%s: parse failed\n", names[descent]);
+				return 1;
+			}
+			if (round == 0){
+				std::ostringstream out;
+				root->unparse(out, 0);
+				unparsed[descent] = out.str();
+			}
+		}
+		times[descent] = best;
+		report(names[descent], best, source.size());
+		std::printf("   %.1f M tokens/s\n", count / best / 1e6);
+	}
+	bool same = unparsed[0] == unparsed[1];
+	std::printf("   %.2fx, %s\n", times[0] / times[1], same ? "identical" : "DIFFERS");
+	return same ? 0 : 1;
+}
+
+struct Benchmark{
+	const char * name;
+	int (*run)(const std::string & input);
+	const char * description;
+};
+
+const Benchmark benchmarks[] = {
+	{ "tokens", benchTokens, "scan, counting heap and arena allocations" },
+	{ "lexers", benchLexers, "tokenizing MB/s of the flex and SIMD backends" },
+	{ "batch", benchBatch, "tokenize into token arrays, then drain them" },
+	{ "parallel", benchParallel, "tokenize on one thread and on all of them" },
+	{ "dump", benchDump, "write scan output: ostream+endl vs TokenDump" },
+	{ "relex", benchRelex, "relex after small edits vs tokenizing again" },
+	{ "lines", benchLines, "line table build and SourceLoc to line:column" },
+	{ "literals", benchLiterals, "scan literal spans, decode them on demand" },
+	{ "parse", benchParse, "repeated parses in one compiler: time and RSS" },
+	{ "traverse", benchTraverse, "parse and walk large function bodies" },
+	{ "flat", benchFlat, "pointer tree vs flat AST: bytes per node, unparse" },
+	{ "dispatch", benchDispatch, "visitor walks over deep expression trees" },
+	{ "depth", benchDepth, "walk one expression nested millions deep" },
+	{ "hash", benchHash, "parse with and without structural hashes" },
+	{ "share", benchShare, "parse with and without shared expressions" },
+	{ "cache", benchCache, "parse from scratch vs load a saved .lilast" },
+	{ "unparse", benchUnparse, "unparse to a file on 1, 2, 4, ... threads" },
+	{ "split", benchSplit, "parse top-level declarations on 1, 2, 4, ... threads" },
+	{ "reparse", benchReparse, "reparse after one-line edits vs parsing again" },
+	{ "pipeline", benchPipeline, "lex, then parse vs lex and parse on two threads" },
+	{ "parsers", benchParsers, "parse throughput of the Bison and descent parsers" },
+};
+
+} // end anonymous namespace
+
+int main(int argc, char ** argv){
+	if (argc < 2 || argc > 3){
+		std::printf("Usage: LilCBench <benchmark> [megabytes]\n");
+		for (const Benchmark & b : benchmarks){
+			std::printf("   %-12s %s\n", b.name, b.description);
+		}
+		return 1;
+	}
+	double megabytes = argc == 3 ? std::atof(argv[2]) : 16;
+	for (const Benchmark & b : benchmarks){
+		if (std::strcmp(argv[1], b.name) == 0){
+			std::string input = generateSource(megabytes);
+			int status = b.run(input);
+			std::remove(input.c_str());
+			return status;
+		}
+	}
+	std::printf("Unknown benchmark %s\n", argv[1]);
+	return 1;
+}
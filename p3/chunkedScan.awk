@@ -0,0 +1,18 @@
+# Writes lines of a few thousand characters that are nearly all string
+# literal or comment, enough of them that --threads=N splits the input
+# into chunks, each split point falling inside a string or comment. A
+# string running to the end of a line ends in \, which lilc.l reports
+# and goes on past; three quarters of the way through, one that
+# doesn't ends the scan. Run as awk -v lines=2000 -f chunkedScan.awk
+BEGIN {
+	text = ""
+	for (i = 0; i < 100; i++) text = text "abc \\\" // \\\\ \\n x"
+	quoted = ""
+	for (i = 0; i < 100; i++) quoted = quoted "say \"hi\\ /* "
+	for (i = 0; i < lines; i++) {
+		if (i == int(lines * 3 / 4)) print "x = \"" text
+		else if (i % 3 == 0) print "int x" i " = \"" text "\\"
+		else if (i % 3 == 1) print "x" i " \"" text "\" + 1 // " quoted
+		else print "x" i " = " i "; // " quoted
+	}
+}
@@ -0,0 +1,28 @@
+# Writes a program nested far deeper than any hand-written one: n
+# parentheses, !s, calls and assignments inside each other, and n / 5
+# blocks. Run as awk -v n=100000 -f deepNesting.awk
+BEGIN {
+	print "int x;"
+	print "int f(int a){ return a; }"
+	print "void main(){"
+	line = "x = "
+	for (i = 0; i < n; i++) line = line "("
+	line = line "x"
+	for (i = 0; i < n; i++) line = line ")"
+	print line ";"
+	line = "x = "
+	for (i = 0; i < n; i++) line = line "!"
+	print line "x;"
+	line = "x = "
+	for (i = 0; i < n; i++) line = line "f(-("
+	line = line "1"
+	for (i = 0; i < n; i++) line = line "), x)"
+	print line ";"
+	line = "x = "
+	for (i = 0; i < n; i++) line = line "x = "
+	print line "1;"
+	for (i = 0; i < n / 5; i++) print "if (x) { while (x < 1) {"
+	print "x++;"
+	for (i = 0; i < n / 5; i++) print "} } else { x--; }"
+	print "}"
+}
@@ -0,0 +1,590 @@
+#include <utility>
+
+#include "descent_parser.hpp"
+#include "lilc_compiler.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+namespace {
+
+// The comparisons, the one level that doesn't associate
+const int COMPARING = 3;
+
+// How tightly tag binds as a binary operator, as lilc.yy declares it;
+// 0 if it isn't one
+int precedence(int tag)
+{
+   switch (tag){
+   case TokenTag::OR:
+      return 1;
+   case TokenTag::AND:
+      return 2;
+   case TokenTag::EQUALS:
+   case TokenTag::NOTEQUALS:
+   case TokenTag::LESS:
+   case TokenTag::GREATER:
+   case TokenTag::LESSEQ:
+   case TokenTag::GREATEREQ:
+      return COMPARING;
+   case TokenTag::PLUS:
+   case TokenTag::MINUS:
+      return 4;
+   case TokenTag::TIMES:
+   case TokenTag::DIVIDE:
+      return 5;
+   default:
+      return 0;
+   }
+}
+
+// A variable declaration, or at the top level any declaration
+bool startsVarDecl(int tag)
+{
+   return tag == TokenTag::INT || tag == TokenTag::BOOL
+      || tag == TokenTag::VOID || tag == TokenTag::STRUCT;
+}
+
+} // end anonymous namespace
+
+LILC::DescentParser::~DescentParser()
+{
+   LilC_Scanner::clearValue(tag, value);
+}
+
+int LILC::DescentParser::parse()
+{
+   try {
+      advance();
+      NodeList<DeclNode *> decls(nodes);
+      while (startsVarDecl(tag)){
+         decls.push_back(decl());
+      }
+      // The empty list at the start of the input is where the program
+      // is, and that is nowhere. Bison's default reduction makes the
+      // program before it looks at a token that can't start a
+      // declaration, so root has the declarations before a stray one.
+      root = nodes.make<ProgramNode>(SourceLoc(),
+         nodes.make<DeclListNode>(SourceLoc(), std::move(decls)));
+      expect(TokenTag::END);
+      return 0;
+   } catch (SyntaxError &){
+      return 1;
+   }
+}
+
+void LILC::DescentParser::advance()
+{
+   LilC_Scanner::clearValue(tag, value);
+   tag = scanner.bufferedLex(&value, &at);
+}
+
+void LILC::DescentParser::expect(int wanted)
+{
+   if (tag != wanted){
+      fail();
+   }
+   advance();
+}
+
+void LILC::DescentParser::fail()
+{
+   scanner.error(at, "syntax error");
+   throw SyntaxError();
+}
+
+LILC::DeclNode * LILC::DescentParser::decl()
+{
+   if (tag == TokenTag::STRUCT){
+      SourceLoc start = at;
+      advance();
+      SourceLoc nameAt = at;
+      IdNode * name = id();
+      if (tag != TokenTag::LCURLY){
+         IdNode * var = id();
+         expect(TokenTag::SEMICOLON);
+         return nodes.make<VarDeclNode>(start,
+            nodes.make<StructNode>(nameAt, name), var, 1);
+      }
+      advance();
+      SourceLoc bodyStart = at;
+      NodeList<DeclNode *> body(nodes);
+      do {
+         body.push_back(varDecl());
+      } while (tag != TokenTag::RCURLY);
+      advance();
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<StructDeclNode>(start,
+         nodes.make<DeclListNode>(bodyStart, std::move(body)), name);
+   }
+   TypeNode * declType = type();
+   IdNode * name = id();
+   if (tag == TokenTag::SEMICOLON){
+      advance();
+      return nodes.make<VarDeclNode>(declType->loc(), declType, name,
+         VarDeclNode::NOT_STRUCT);
+   }
+   SourceLoc formalsStart = at;
+   NodeList<FormalDeclNode *> list = formals();
+   FnBodyNode * body = fnBody();
+   return nodes.make<FnDeclNode>(declType->loc(), declType, name,
+      nodes.make<FormalsListNode>(formalsStart, std::move(list)), body);
+}
+
+LILC::VarDeclNode * LILC::DescentParser::varDecl()
+{
+   if (tag == TokenTag::STRUCT){
+      SourceLoc start = at;
+      advance();
+      SourceLoc nameAt = at;
+      IdNode * name = id();
+      IdNode * var = id();
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<VarDeclNode>(start,
+         nodes.make<StructNode>(nameAt, name), var, 1);
+   }
+   TypeNode * declType = type();
+   IdNode * name = id();
+   expect(TokenTag::SEMICOLON);
+   return nodes.make<VarDeclNode>(declType->loc(), declType, name,
+      VarDeclNode::NOT_STRUCT);
+}
+
+LILC::NodeList<LILC::DeclNode *> LILC::DescentParser::varDecls()
+{
+   NodeList<DeclNode *> decls(nodes);
+   while (startsVarDecl(tag)){
+      decls.push_back(varDecl());
+   }
+   return decls;
+}
+
+LILC::NodeList<LILC::FormalDeclNode *> LILC::DescentParser::formals()
+{
+   expect(TokenTag::LPAREN);
+   if (tag == TokenTag::RPAREN){
+      advance();
+      return NodeList<FormalDeclNode *>(nodes);
+   }
+   std::vector<FormalDeclNode *> parsed;
+   while (true){
+      TypeNode * formalType = type();
+      IdNode * name = id();
+      parsed.push_back(nodes.make<FormalDeclNode>(formalType->loc(),
+         formalType, name));
+      if (tag != TokenTag::COMMA){
+         break;
+      }
+      advance();
+   }
+   expect(TokenTag::RPAREN);
+   // lilc.yy's formalsList is right recursive, so the last formal is
+   // first
+   NodeList<FormalDeclNode *> list(nodes);
+   list.reserve(parsed.size());
+   for (size_t i = parsed.size(); i > 0; i--){
+      list.push_back(parsed[i - 1]);
+   }
+   return list;
+}
+
+// The blocks nested in the body are open at once, innermost last; each
+// is made into its statement when its closing brace comes
+LILC::FnBodyNode * LILC::DescentParser::fnBody()
+{
+   open(OpenBlock::BODY, at, nullptr);
+   while (true){
+      if (tag == TokenTag::IF || tag == TokenTag::WHILE){
+         SourceLoc start = at;
+         OpenBlock::Kind kind = tag == TokenTag::IF ? OpenBlock::IF
+            : OpenBlock::WHILE;
+         advance();
+         expect(TokenTag::LPAREN);
+         ExpNode * cond = exp().exp;
+         expect(TokenTag::RPAREN);
+         open(kind, start, cond);
+         continue;
+      }
+      if (tag != TokenTag::RCURLY){
+         StmtNode * made = stmt();
+         blocks.back().stmts.push_back(made);
+         continue;
+      }
+      advance();
+      OpenBlock closed = std::move(blocks.back());
+      blocks.pop_back();
+      DeclListNode * decls = nodes.make<DeclListNode>(closed.brace,
+         std::move(closed.decls));
+      StmtListNode * stmts = nodes.make<StmtListNode>(closed.brace,
+         std::move(closed.stmts));
+      StmtNode * made;
+      switch (closed.kind){
+      case OpenBlock::BODY:
+         return nodes.make<FnBodyNode>(closed.start, decls, stmts);
+      case OpenBlock::IF:
+         if (tag == TokenTag::ELSE){
+            advance();
+            open(OpenBlock::ELSE, closed.start, closed.cond);
+            blocks.back().thenDecls = decls;
+            blocks.back().thenStmts = stmts;
+            continue;
+         }
+         made = nodes.make<IfStmtNode>(closed.start, closed.cond, decls,
+            stmts);
+         break;
+      case OpenBlock::ELSE:
+         made = nodes.make<IfElseStmtNode>(closed.start, closed.cond,
+            closed.thenDecls, closed.thenStmts, decls, stmts);
+         break;
+      default:
+         made = nodes.make<WhileStmtNode>(closed.start, closed.cond, decls,
+            stmts);
+         break;
+      }
+      blocks.back().stmts.push_back(made);
+   }
+}
+
+// { varDecls, with stmts to come; each list is where the brace is
+void LILC::DescentParser::open(OpenBlock::Kind kind, SourceLoc start,
+ExpNode * cond)
+{
+   SourceLoc brace = at;
+   expect(TokenTag::LCURLY);
+   NodeList<DeclNode *> decls = varDecls();
+   blocks.push_back(OpenBlock{ kind, start, brace, cond, nullptr, nullptr,
+      std::move(decls), NodeList<StmtNode *>(nodes) });
+}
+
+// Any statement but if and while, whose blocks fnBody keeps open
+LILC::StmtNode * LILC::DescentParser::stmt()
+{
+   SourceLoc start = at;
+   switch (tag){
+   case TokenTag::ID: {
+      IdNode * name = id();
+      if (tag == TokenTag::LPAREN){
+         ExpNode * called = call(name, start);
+         expect(TokenTag::SEMICOLON);
+         return nodes.make<CallStmtNode>(start, called);
+      }
+      ExpNode * target = loc(name, start);
+      if (tag == TokenTag::ASSIGN){
+         advance();
+         ExpNode * assigned = exp().exp;
+         AssignNode * assign = nodes.make<AssignNode>(start, target,
+            assigned);
+         expect(TokenTag::SEMICOLON);
+         return nodes.make<AssignStmtNode>(start, assign);
+      }
+      if (tag == TokenTag::PLUSPLUS){
+         advance();
+         expect(TokenTag::SEMICOLON);
+         return nodes.make<PostIncStmtNode>(start, target);
+      }
+      expect(TokenTag::MINUSMINUS);
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<PostDecStmtNode>(start, target);
+   }
+   case TokenTag::INPUT: {
+      advance();
+      expect(TokenTag::READ);
+      SourceLoc targetAt = at;
+      ExpNode * target = loc(id(), targetAt);
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<ReadStmtNode>(start, target);
+   }
+   case TokenTag::OUTPUT: {
+      advance();
+      expect(TokenTag::WRITE);
+      ExpNode * written = exp().exp;
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<WriteStmtNode>(start, written);
+   }
+   case TokenTag::RETURN: {
+      advance();
+      ExpNode * returned = nullptr;
+      if (tag != TokenTag::SEMICOLON){
+         returned = exp().exp;
+      }
+      expect(TokenTag::SEMICOLON);
+      return nodes.make<ReturnStmtNode>(start, returned);
+   }
+   default:
+      fail();
+   }
+}
+
+LILC::TypeNode * LILC::DescentParser::type()
+{
+   SourceLoc start = at;
+   switch (tag){
+   case TokenTag::INT:
+      advance();
+      return nodes.make<IntNode>(start);
+   case TokenTag::BOOL:
+      advance();
+      return nodes.make<BoolNode>(start);
+   case TokenTag::VOID:
+      advance();
+      return nodes.make<VoidNode>(start);
+   default:
+      fail();
+   }
+}
+
+LILC::IdNode * LILC::DescentParser::id()
+{
+   if (tag != TokenTag::ID){
+      fail();
+   }
+   IdNode * made = exps.make<IdNode>(value.as<IDToken *>());
+   advance();
+   return made;
+}
+
+// first, the identifier at start, and any . fields after it
+LILC::ExpNode * LILC::DescentParser::loc(IdNode * first, SourceLoc start)
+{
+   ExpNode * made = first;
+   while (tag == TokenTag::DOT){
+      advance();
+      IdNode * field = id();
+      made = exps.make<DotAccessNode>(start, made, field);
+   }
+   return made;
+}
+
+// The actuals are pushed to the front one by one, as lilc.yy does
+LILC::ExpNode * LILC::DescentParser::call(IdNode * name, SourceLoc start)
+{
+   size_t base = pending.size();
+   ExpNode * made = openCall(name, start);
+   if (made != nullptr){
+      return made;
+   }
+   return climb(base).exp;
+}
+
+// Past the (, the call when it has no actuals; otherwise nullptr, with
+// the call pending on its first actual
+LILC::ExpNode * LILC::DescentParser::openCall(IdNode * name, SourceLoc start)
+{
+   advance();
+   SourceLoc listStart = at;
+   if (tag == TokenTag::RPAREN){
+      advance();
+      return nodes.make<CallExpNode>(start, name,
+         nodes.make<ExpListNode>(listStart, NodeList<ExpNode *>(nodes)));
+   }
+   push(Pending::CALL, start);
+   pending.back().name = name;
+   pending.back().listStart = listStart;
+   calls.emplace_back(nodes);
+   push(Pending::EXP, at);
+   return nullptr;
+}
+
+LILC::DescentParser::Operand LILC::DescentParser::exp()
+{
+   size_t base = pending.size();
+   push(Pending::EXP, at);
+   return climb(base);
+}
+
+// Precedence climbing: an operand and then every binary operator
+// binding at least as tightly as an EXP's minPrecedence, each taking
+// the tighter operators to its right as its right operand. What the
+// recursion would hold is pending instead, above base, until the
+// expression it started with is whole.
+LILC::DescentParser::Operand LILC::DescentParser::climb(size_t base)
+{
+   Operand made;
+   while (true){
+      if (operand(made, base) && reduce(made, base)){
+         return made;
+      }
+   }
+}
+
+// A binary operator's operand: a term or assignment, or one under !
+// or -, which bind more tightly than any binary operator. False if
+// made isn't one yet: a ! or - or something with an expression inside
+// is pending on it instead.
+bool LILC::DescentParser::operand(Operand & made, size_t base)
+{
+   SourceLoc start = at;
+   // - applies only to a term
+   bool assignable = pending.size() == base
+      || pending.back().kind != Pending::MINUS;
+   switch (tag){
+   case TokenTag::NOT:
+   case TokenTag::MINUS:
+      if (!assignable){
+         fail();
+      }
+      push(tag == TokenTag::NOT ? Pending::NOT : Pending::MINUS, start);
+      advance();
+      return false;
+   case TokenTag::ID: {
+      IdNode * name = id();
+      if (tag == TokenTag::LPAREN){
+         made.exp = openCall(name, start);
+         made.start = start;
+         return made.exp != nullptr;
+      }
+      ExpNode * target = loc(name, start);
+      if (assignable && tag == TokenTag::ASSIGN){
+         advance();
+         push(Pending::ASSIGN, start);
+         pending.back().target = target;
+         push(Pending::EXP, at);
+         return false;
+      }
+      made = Operand{ target, start };
+      return true;
+   }
+   case TokenTag::INTLITERAL: {
+      int literal = value.as<IntLitToken *>()->value();
+      advance();
+      made = Operand{ exps.make<IntLitNode>(start, literal), start };
+      return true;
+   }
+   case TokenTag::STRINGLITERAL:
+      made = Operand{ nodes.make<StrLitNode>(value.as<StringLitToken *>()),
+         start };
+      advance();
+      return true;
+   case TokenTag::TRUE:
+      advance();
+      made = Operand{ nodes.make<TrueNode>(start), start };
+      return true;
+   case TokenTag::FALSE:
+      advance();
+      made = Operand{ nodes.make<FalseNode>(start), start };
+      return true;
+   case TokenTag::LPAREN:
+      advance();
+      push(Pending::PAREN, start);
+      push(Pending::EXP, at);
+      return false;
+   default:
+      fail();
+   }
+}
+
+// Gives made to what is pending on it, and what that makes to what is
+// pending on that, for as long as they are whole. True once the
+// expression climb started with is; false if another operand is next.
+bool LILC::DescentParser::reduce(Operand & made, size_t base)
+{
+   while (pending.size() > base){
+      Pending & top = pending.back();
+      switch (top.kind){
+      case Pending::NOT:
+         made = Operand{ exps.make<NotNode>(top.start, made.exp), top.start };
+         break;
+      case Pending::MINUS:
+         made = Operand{ exps.make<UnaryMinusNode>(top.start, made.exp),
+            top.start };
+         break;
+      case Pending::PAREN:
+         expect(TokenTag::RPAREN);
+         made.start = top.start;
+         break;
+      case Pending::ASSIGN:
+         made = Operand{ nodes.make<AssignNode>(top.start, top.target,
+            made.exp), top.start };
+         break;
+      case Pending::CALL: {
+         NodeList<ExpNode *> & actuals = calls.back();
+         if (actuals.size() == 0){
+            top.listStart = made.start;
+         }
+         actuals.push_front(made.exp);
+         if (tag == TokenTag::COMMA){
+            advance();
+            push(Pending::EXP, at);
+            return false;
+         }
+         expect(TokenTag::RPAREN);
+         made = Operand{ nodes.make<CallExpNode>(top.start, top.name,
+            nodes.make<ExpListNode>(top.listStart, std::move(actuals))),
+            top.start };
+         calls.pop_back();
+         break;
+      }
+      default: {
+         if (top.op != 0){
+            int level = precedence(top.op);
+            made = Operand{ binary(top.op, top.left, made.exp),
+               top.left.start };
+            top.op = 0;
+            // Nonassociative: a == b == c is an error
+            if (level == COMPARING && precedence(tag) == COMPARING){
+               fail();
+            }
+         }
+         int level = precedence(tag);
+         if (level != 0 && level >= top.minPrecedence){
+            top.left = made;
+            top.op = tag;
+            advance();
+            // Left associative: an operator of the same level to the
+            // right belongs to the next round, not to the right operand
+            push(Pending::EXP, at);
+            pending.back().minPrecedence = level + 1;
+            return false;
+         }
+         break;
+      }
+      }
+      pending.pop_back();
+   }
+   return true;
+}
+
+// A construct of kind at start; an EXP takes every binary operator
+void LILC::DescentParser::push(Pending::Kind kind, SourceLoc start)
+{
+   Pending made;
+   made.kind = kind;
+   made.start = start;
+   made.minPrecedence = 1;
+   made.left = Operand{ nullptr, start };
+   made.op = 0;
+   made.target = nullptr;
+   made.name = nullptr;
+   pending.push_back(made);
+}
+
+LILC::ExpNode * LILC::DescentParser::binary(int op, Operand left,
+ExpNode * right)
+{
+   SourceLoc start = left.start;
+   switch (op){
+   case TokenTag::OR:
+      return exps.make<OrNode>(start, left.exp, right);
+   case TokenTag::AND:
+      return exps.make<AndNode>(start, left.exp, right);
+   case TokenTag::EQUALS:
+      return exps.make<EqualsNode>(start, left.exp, right);
+   case TokenTag::NOTEQUALS:
+      return exps.make<NotEqualsNode>(start, left.exp, right);
+   case TokenTag::LESS:
+      return exps.make<LessNode>(start, left.exp, right);
+   case TokenTag::GREATER:
+      return exps.make<GreaterNode>(start, left.exp, right);
+   case TokenTag::LESSEQ:
+      return exps.make<LessEqNode>(start, left.exp, right);
+   case TokenTag::GREATEREQ:
+      return exps.make<GreaterEqNode>(start, left.exp, right);
+   case TokenTag::PLUS:
+      return exps.make<PlusNode>(start, left.exp, right);
+   case TokenTag::MINUS:
+      return exps.make<MinusNode>(start, left.exp, right);
+   case TokenTag::TIMES:
+      return exps.make<TimesNode>(start, left.exp, right);
+   default:
+      return exps.make<DivideNode>(start, left.exp, right);
+   }
+}
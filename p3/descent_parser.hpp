@@ -0,0 +1,131 @@
+#ifndef __LILC_DESCENT_PARSER_HPP__
+#define __LILC_DESCENT_PARSER_HPP__ 1
+
+#include <vector>
+
+#include "arena.hpp"
+#include "ast.hpp"
+#include "exp_table.hpp"
+#include "source_loc.hpp"
+#include "grammar.hh"
+
+namespace LILC{
+
+class LilC_Scanner;
+
+/*
+Hand-written parser for the grammar of lilc.yy, a stand-in for
+LilC_Parser that takes the same scanner, root, arena and expression
+table and builds the same tree: the same nodes, made in the same order
+and with the same locations. Declarations and statements are parsed by
+recursive descent, one token of lookahead deciding every choice, and
+expressions by precedence climbing over the binary operators, with
+the precedences and associativities lilc.yy declares.
+
+The grammar's corners are kept as Bison resolves them. An identifier
+followed by = starts an assignment wherever an operand may be, and
+its right side is a whole expression, so a + b = c is a + (b = c).
+! applies to an operand, but - only to a term: -(a + b) is fine and
+- -a is not. The comparisons don't chain. Formals and actuals go into
+their lists in the orders lilc.yy's rules leave them in, and a rule's
+location is that of its first symbol, so (a) + b is where the
+parenthesis is. Locations come from the tokens, never from an IdNode,
+which with sharing on may be an earlier occurrence's.
+
+A syntax error is reported, as LilC_Parser reports one, at the first
+token no program could continue with, and parse then gives up. What is
+nested, blocks in blocks and expressions in expressions, is kept on
+stacks on the heap rather than by recursion, as LilC_Parser keeps it,
+so however deep the nesting the two accept the same programs.
+ */
+class DescentParser{
+public:
+	DescentParser(LilC_Scanner & scanner, ProgramNode * & root,
+		Arena & nodes, ExpTable & exps)
+	: scanner(scanner), root(root), nodes(nodes), exps(exps){}
+	DescentParser(const DescentParser&) = delete;
+	DescentParser& operator=(const DescentParser&) = delete;
+	~DescentParser();
+
+	// 0 with the program in root, 1 after a syntax error, as
+	// LilC_Parser::parse
+	int parse();
+private:
+	struct SyntaxError{};
+	// An expression and where its text starts, which for one in
+	// parentheses is the opening parenthesis
+	struct Operand{
+		ExpNode * exp;
+		SourceLoc start;
+	};
+	// A construct an expression is inside of, waiting for it
+	struct Pending{
+		enum Kind{ EXP, NOT, MINUS, PAREN, ASSIGN, CALL } kind;
+		SourceLoc start;
+		// EXP: the least precedence of its operators; its left
+		// operand, once there is one, and the operator waiting for
+		// the right one, or 0
+		int minPrecedence;
+		Operand left;
+		int op;
+		// ASSIGN: what is assigned to
+		ExpNode * target;
+		// CALL: the function and where its actuals start; the
+		// actuals are the last list of calls
+		IdNode * name;
+		SourceLoc listStart;
+	};
+	// A block whose closing brace is still to come
+	struct OpenBlock{
+		enum Kind{ BODY, IF, ELSE, WHILE } kind;
+		// The statement's or function body's, and the brace's
+		SourceLoc start;
+		SourceLoc brace;
+		ExpNode * cond;
+		// ELSE: the if's own block
+		DeclListNode * thenDecls;
+		StmtListNode * thenStmts;
+		NodeList<DeclNode *> decls;
+		NodeList<StmtNode *> stmts;
+	};
+
+	void advance();
+	void expect(int tag);
+	[[noreturn]] void fail();
+
+	DeclNode * decl();
+	VarDeclNode * varDecl();
+	NodeList<DeclNode *> varDecls();
+	NodeList<FormalDeclNode *> formals();
+	FnBodyNode * fnBody();
+	// Opens { varDecls stmts } for fnBody to fill
+	void open(OpenBlock::Kind kind, SourceLoc start, ExpNode * cond);
+	StmtNode * stmt();
+	TypeNode * type();
+	IdNode * id();
+	ExpNode * loc(IdNode * first, SourceLoc start);
+	ExpNode * call(IdNode * name, SourceLoc start);
+	ExpNode * openCall(IdNode * name, SourceLoc start);
+	Operand exp();
+	Operand climb(size_t base);
+	bool operand(Operand & made, size_t base);
+	bool reduce(Operand & made, size_t base);
+	void push(Pending::Kind kind, SourceLoc start);
+	ExpNode * binary(int op, Operand left, ExpNode * right);
+
+	LilC_Scanner & scanner;
+	ProgramNode * & root;
+	Arena & nodes;
+	ExpTable & exps;
+	// The lookahead token
+	int tag = LilC_Parser::token::END;
+	LilC_Parser::semantic_type value;
+	SourceLoc at;
+	std::vector<OpenBlock> blocks;
+	std::vector<Pending> pending;
+	std::vector<NodeList<ExpNode *>> calls;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_DESCENT_PARSER_HPP__ */
@@ -0,0 +1,100 @@
+#include "exp_table.hpp"
+
+namespace {
+
+uint64_t mix(uint64_t h, uint64_t v){
+	h ^= v + 0x9E3779B97F4A7C15ULL;
+	h *= 0xBF58476D1CE4E5B9ULL;
+	return h ^ (h >> 31);
+}
+
+uint64_t address(const void * p){
+	return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+}
+
+} // end anonymous namespace
+
+LILC::ExpTable::Key LILC::ExpTable::keyOf(const ExpNode & n)
+{
+   Key key = { n.kind(), 0, 0, 0 };
+   switch (n.kind()){
+   case NodeKind::INT_LIT:
+      key.a = static_cast<uint32_t>(static_cast<const IntLitNode &>(n).value());
+      break;
+   case NodeKind::ID:
+      key.a = static_cast<const IdNode &>(n).name().id();
+      break;
+   case NodeKind::DOT_ACCESS:
+      {
+      const DotAccessNode & e = static_cast<const DotAccessNode &>(n);
+      key.a = address(e.exp());
+      key.b = address(e.id());
+      break;
+      }
+   case NodeKind::UNARY_MINUS:
+   case NodeKind::NOT:
+      key.a = address(static_cast<const UnaryExpNode &>(n).exp());
+      break;
+   default:
+      {
+      // Binary operators; nothing else is made through the table
+      const BinaryExpNode & e = static_cast<const BinaryExpNode &>(n);
+      key.a = address(e.lhs());
+      key.b = address(e.rhs());
+      break;
+      }
+   }
+   key.hash = mix(mix(mix(0, static_cast<uint64_t>(key.kind)), key.a), key.b);
+   return key;
+}
+
+size_t LILC::ExpTable::find(const Key & key)
+{
+   if (slots.empty()){
+      slots.assign(256, Slot());
+   }
+   size_t mask = slots.size() - 1;
+   size_t i = static_cast<size_t>(key.hash) & mask;
+   while (ExpNode * n = slots[i].node){
+      if (slots[i].hash == key.hash && n->kind() == key.kind){
+         Key other = keyOf(*n);
+         if (other.a == key.a && other.b == key.b){
+            return i;
+         }
+      }
+      i = (i + 1) & mask;
+   }
+   return i;
+}
+
+void LILC::ExpTable::insert(size_t slot, uint64_t hash, ExpNode * node)
+{
+   slots[slot].hash = hash;
+   slots[slot].node = node;
+   // Keep the load factor under one half
+   if (++count * 2 > slots.size()){
+      rehash();
+   }
+}
+
+void LILC::ExpTable::rehash()
+{
+   std::vector<Slot> old(slots.size() * 2, Slot());
+   old.swap(slots);
+   size_t mask = slots.size() - 1;
+   for (const Slot & s : old){
+      if (s.node == nullptr){ continue; }
+      size_t i = static_cast<size_t>(s.hash) & mask;
+      while (slots[i].node != nullptr){
+         i = (i + 1) & mask;
+      }
+      slots[i] = s;
+   }
+}
+
+void LILC::ExpTable::clear()
+{
+   slots.clear();
+   count = 0;
+   reuses = 0;
+}
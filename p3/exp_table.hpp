@@ -0,0 +1,97 @@
+#ifndef __LILC_EXP_TABLE_HPP__
+#define __LILC_EXP_TABLE_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "arena.hpp"
+#include "ast.hpp"
+
+namespace LILC{
+
+/*
+Builds the expression nodes that never change once made: IntLitNode,
+IdNode, DotAccessNode and the unary and binary operators. With sharing
+off, make<T>(args...) is nodes.make<T>(args...). With it on, a node of
+the same kind, payload and children as one already built is that node,
+so every distinct subexpression is stored once and two of these
+expressions are structurally equal exactly when they are the same
+pointer. That is a common subexpression table as it stands: a later
+pass can number values by node address. Equal is structural, not equal
+in value; x + 1 before and after an assignment to x is one node.
+
+Children are shared before their parents are made, so a key is just a
+kind, a payload and the children's addresses, and no lookup goes more
+than one level down.
+
+A shared node has the SourceLoc of its first occurrence, and a pass
+that annotated one in place would annotate every occurrence, which is
+why sharing is off unless asked for. Statements, declarations, calls,
+assignments and the other literals are always made fresh.
+ */
+class ExpTable{
+public:
+	explicit ExpTable(Arena & nodes) : nodes(nodes){}
+	ExpTable(const ExpTable&) = delete;
+	ExpTable& operator=(const ExpTable&) = delete;
+
+	void setSharing(bool on){ share = on; }
+	bool sharing() const { return share; }
+
+	template <typename T, typename... Args>
+	T * make(Args&&... args){
+		if (!share){
+			return nodes.make<T>(std::forward<Args>(args)...);
+		}
+		// Nodes are plain data, so the candidate can be built where
+		// it is and only copied into the arena if it is new
+		T candidate(std::forward<Args>(args)...);
+		Key key = keyOf(candidate);
+		size_t slot = find(key);
+		if (slots[slot].node != nullptr){
+			reuses++;
+			return static_cast<T *>(slots[slot].node);
+		}
+		T * made = nodes.make<T>(candidate);
+		insert(slot, key.hash, made);
+		return made;
+	}
+
+	// Forget every node; called when the arena they are in is reset
+	void clear();
+
+	// Distinct nodes made while sharing, and how many makes were
+	// answered with one of them instead
+	size_t size() const { return count; }
+	size_t reused() const { return reuses; }
+private:
+	struct Key{
+		NodeKind kind;
+		uint64_t a;
+		uint64_t b;
+		uint64_t hash;
+	};
+	struct Slot{
+		uint64_t hash;
+		ExpNode * node;
+	};
+
+	static Key keyOf(const ExpNode & n);
+	// The slot holding key's node, or the empty one it would go in
+	size_t find(const Key & key);
+	void insert(size_t slot, uint64_t hash, ExpNode * node);
+	void rehash();
+
+	Arena & nodes;
+	bool share = false;
+	// Open addressing, linear probing; size is always a power of two
+	std::vector<Slot> slots;
+	size_t count = 0;
+	size_t reuses = 0;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_EXP_TABLE_HPP__ */
@@ -0,0 +1,113 @@
+#include "flat_ast.hpp"
+
+namespace {
+
+using LILC::NodeKind;
+
+int arity(NodeKind k){ return LILC::FlatAST::ARITY[static_cast<int>(k)]; }
+
+template <typename T>
+size_t bytesOf(const std::vector<T> & v){ return v.capacity() * sizeof(T); }
+
+} // end anonymous namespace
+
+const LILC::FlatAST::NodeId LILC::FlatAST::NONE;
+const int LILC::FlatAST::LIST;
+constexpr signed char LILC::FlatAST::ARITY[];
+
+void LILC::FlatAST::clear()
+{
+   kinds.clear();
+   locs.clear();
+   data.clear();
+   edges.clear();
+   atoms.clear();
+   strings.clear();
+}
+
+void LILC::FlatAST::reserve(size_t nodes)
+{
+   kinds.reserve(nodes);
+   locs.reserve(nodes);
+   data.reserve(nodes);
+   // Every node but the root is one edge; lists and variables add a
+   // word each on top
+   edges.reserve(nodes + nodes / 8);
+}
+
+size_t LILC::FlatAST::footprint() const
+{
+   return bytesOf(kinds) + bytesOf(locs) + bytesOf(data) + bytesOf(edges)
+      + bytesOf(atoms) + bytesOf(strings);
+}
+
+const LILC::FlatAST::NodeId * LILC::FlatAST::childBegin(NodeId n) const
+{
+   int count = arity(kinds[n]);
+   if (count == 0){
+      return nullptr;
+   }
+   return edges.data() + data[n] + (count == LIST ? 1 : 0);
+}
+
+size_t LILC::FlatAST::childCount(NodeId n) const
+{
+   int count = arity(kinds[n]);
+   return count == LIST ? edges[data[n]] : static_cast<size_t>(count);
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::append(NodeKind k, SourceLoc l,
+uint32_t word)
+{
+   kinds.push_back(k);
+   locs.push_back(l);
+   data.push_back(word);
+   return static_cast<NodeId>(kinds.size() - 1);
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::add(NodeKind k, SourceLoc l,
+const NodeId * children, size_t count)
+{
+   if (arity(k) == 0){
+      return append(k, l, 0);
+   }
+   uint32_t first = static_cast<uint32_t>(edges.size());
+   if (arity(k) == LIST){
+      edges.push_back(static_cast<uint32_t>(count));
+   }
+   edges.insert(edges.end(), children, children + count);
+   return append(k, l, first);
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::addVarDecl(SourceLoc l, NodeId type,
+NodeId id, int size)
+{
+   NodeId children[] = { type, id };
+   NodeId n = add(NodeKind::VAR_DECL, l, children, 2);
+   edges.push_back(static_cast<uint32_t>(size));
+   return n;
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::addId(SourceLoc l, Atom name)
+{
+   uint32_t id = name.id();
+   if (id >= atoms.size()){
+      atoms.resize(id + 1);
+   }
+   atoms[id] = name;
+   return append(NodeKind::ID, l, id);
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::addIntLit(SourceLoc l, int value)
+{
+   return append(NodeKind::INT_LIT, l, static_cast<uint32_t>(value));
+}
+
+LILC::FlatAST::NodeId LILC::FlatAST::addStrLit(SourceLoc l,
+const char * text, size_t length)
+{
+   StrSpan span = { text, static_cast<uint32_t>(length) };
+   strings.push_back(span);
+   return append(NodeKind::STR_LIT, l,
+      static_cast<uint32_t>(strings.size() - 1));
+}
@@ -0,0 +1,173 @@
+#ifndef __LILC_FLAT_AST_HPP__
+#define __LILC_FLAT_AST_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "interner.hpp"
+#include "node_kind.hpp"
+#include "source_loc.hpp"
+
+namespace LILC{
+
+class ThreadPool;
+class OutputBuffer;
+
+/*
+The AST as a few dense arrays instead of a tree of objects. A node is a
+32-bit NodeId indexing three columns: its kind (a byte), its SourceLoc
+and one word of data, 9 bytes in all. What the word means depends on
+the kind:
+
+   lists          index in edges of the child count, children after it
+   ID             Atom::id() of the name, looked up in atoms
+   INT_LIT        the value itself
+   STR_LIT        index in strings of the literal's spelling
+   anything else  index in edges of its children, as many as the
+                  node class has, in the order they appear in the
+                  source; a VAR_DECL's size follows its two children,
+                  and a missing child (return;) is NONE
+
+Nodes are appended bottom-up, so children always have smaller ids than
+their parent and the root is the last node. Nothing is ever removed;
+clear() empties the arrays for the next compilation but keeps their
+storage. It can be walked with a TreeWalker (ast_walker.hpp), like
+ASTTree.
+ */
+class FlatAST{
+public:
+	typedef uint32_t NodeId;
+	typedef NodeId Node;
+	static const NodeId NONE = UINT32_MAX;
+
+	// Children of the nodes with a fixed number of them; LIST for the
+	// list kinds, whose count is stored with the children
+	static const int LIST = -1;
+	static constexpr signed char ARITY[NODE_KIND_COUNT] = {
+		1,    // PROGRAM
+		LIST, // DECL_LIST
+		2,    // VAR_DECL
+		4,    // FN_DECL
+		2,    // FORMAL_DECL
+		2,    // STRUCT_DECL
+		LIST, // FORMALS_LIST
+		2,    // FN_BODY
+		LIST, // STMT_LIST
+		LIST, // EXP_LIST
+		0,    // INT_TYPE
+		0,    // BOOL_TYPE
+		0,    // VOID_TYPE
+		1,    // STRUCT_TYPE
+		1,    // ASSIGN_STMT
+		1,    // POST_INC_STMT
+		1,    // POST_DEC_STMT
+		1,    // READ_STMT
+		1,    // WRITE_STMT
+		3,    // IF_STMT
+		5,    // IF_ELSE_STMT
+		3,    // WHILE_STMT
+		1,    // CALL_STMT
+		1,    // RETURN_STMT
+		0,    // INT_LIT
+		0,    // STR_LIT
+		0,    // TRUE_LIT
+		0,    // FALSE_LIT
+		0,    // ID
+		2,    // DOT_ACCESS
+		2,    // ASSIGN
+		2,    // CALL_EXP
+		1,    // UNARY_MINUS
+		1,    // NOT
+		2,    // PLUS
+		2,    // MINUS
+		2,    // TIMES
+		2,    // DIVIDE
+		2,    // AND
+		2,    // OR
+		2,    // EQUALS
+		2,    // NOT_EQUALS
+		2,    // LESS
+		2,    // GREATER
+		2,    // LESS_EQ
+		2,    // GREATER_EQ
+	};
+
+	void clear();
+	void reserve(size_t nodes);
+
+	size_t size() const { return kinds.size(); }
+	bool empty() const { return kinds.empty(); }
+	NodeId root() const { return static_cast<NodeId>(kinds.size() - 1); }
+
+	NodeKind kind(NodeId n) const { return kinds[n]; }
+	static bool present(NodeId n){ return n != NONE; }
+	SourceLoc loc(NodeId n) const { return locs[n]; }
+
+	const NodeId * childBegin(NodeId n) const;
+	size_t childCount(NodeId n) const;
+	NodeId child(NodeId n, size_t i) const { return childBegin(n)[i]; }
+	// Calls f(i, child) for each child of n, in order; K is its kind,
+	// as TreeWalker has it to hand, so the loop is unrolled for all
+	// but lists
+	template <NodeKind K, typename F>
+	void forEachChild(NodeId n, F && f) const {
+		const int arity = ARITY[static_cast<int>(K)];
+		if (arity == 0){
+			return;
+		}
+		const NodeId * first = edges.data() + data[n];
+		size_t count = arity;
+		if (arity == LIST){
+			count = *first++;
+		}
+		for (size_t i = 0; i < count; i++){ f(i, first[i]); }
+	}
+
+	Atom name(NodeId n) const { return atoms[data[n]]; }
+	int intValue(NodeId n) const { return static_cast<int>(data[n]); }
+	const char * strText(NodeId n) const { return strings[data[n]].text; }
+	size_t strLength(NodeId n) const { return strings[data[n]].length; }
+	int varDeclSize(NodeId n) const {
+		return static_cast<int>(edges[data[n] + 2]);
+	}
+
+	// Building, children first
+	NodeId add(NodeKind k, SourceLoc l, const NodeId * children, size_t count);
+	NodeId addVarDecl(SourceLoc l, NodeId type, NodeId id, int size);
+	NodeId addId(SourceLoc l, Atom name);
+	NodeId addIntLit(SourceLoc l, int value);
+	NodeId addStrLit(SourceLoc l, const char * text, size_t length);
+
+	// Same output as ProgramNode::unparse on the tree it was built
+	// from; defined with it in unparse.cpp
+	void unparse(std::ostream& out) const;
+	// The same in parts, as ProgramNode's
+	void unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts) const;
+
+	// Bytes held by the arrays, spare capacity included
+	size_t footprint() const;
+private:
+	// Saves the arrays as they are (ast_cache.hpp)
+	friend class ASTImage;
+
+	struct StrSpan{
+		const char * text;
+		uint32_t length;
+	};
+
+	NodeId append(NodeKind k, SourceLoc l, uint32_t word);
+
+	std::vector<NodeKind> kinds;
+	std::vector<SourceLoc> locs;
+	std::vector<uint32_t> data;
+	std::vector<NodeId> edges;
+	// Identifiers, indexed by atom id so each name is stored once
+	std::vector<Atom> atoms;
+	std::vector<StrSpan> strings;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_FLAT_AST_HPP__ */
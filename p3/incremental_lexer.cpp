@@ -0,0 +1,172 @@
+/*
+Incremental relexing. As parallel_lexer.cpp relies on too, no LilC
+token contains a newline and every pattern stops at one, so both
+scanner backends are in their initial state at the start of every
+line and what they produce for a line depends on that line alone. An
+edit can therefore only change the tokens of the lines it touches.
+relex starts again at the start of the line the edit begins on (the
+last token boundary before the edit with a known scanner state) and
+stops after the newline ending the line where the inserted text ends,
+which is exactly where the new stream is back in step with the old.
+The old tokens past that point are kept, moved by the change in
+length; the scanner's LineTable is edited alongside, so their lines
+follow without being stored.
+
+The one exception is a string literal error that ends the scan (lilc.l
+returns 0 for it): if one appears in the relexed lines everything
+after it goes, and if one disappears from them the rest of the file
+has to be lexed after all.
+ */
+#include <cstring>
+#include <string>
+
+#include "lilc_scanner.hpp"
+
+namespace {
+
+void append(LILC::TokenBuffer &to, const LILC::TokenBuffer &from,
+	size_t count){
+	for (size_t i = 0; i < count; i++){
+		to.push(from.tags[i], from.starts[i], from.lengths[i]);
+	}
+}
+
+} // end anonymous namespace
+
+size_t LILC::LilC_Scanner::firstTokenAt(size_t at) const
+{
+   size_t lo = 0, hi = tokenCount();
+   while (lo < hi){
+      size_t mid = lo + (hi - lo) / 2;
+      if (tokenOffset(mid) < at){ lo = mid + 1; } else { hi = mid; }
+   }
+   return lo;
+}
+
+// Move the gap so it starts before logical token index. Entries that
+// cross it switch between plain and shifted positions.
+void LILC::LilC_Scanner::moveGap(size_t index)
+{
+   while (gapBegin > index){
+      gapBegin--;
+      size_t to = gapBegin + gapLength;
+      batch.tags[to] = batch.tags[gapBegin];
+      batch.starts[to] = batch.starts[gapBegin] - tailShift;
+      batch.lengths[to] = batch.lengths[gapBegin];
+   }
+   while (gapBegin < index){
+      size_t from = gapBegin + gapLength;
+      batch.tags[gapBegin] = batch.tags[from];
+      batch.starts[gapBegin] = batch.starts[from] + tailShift;
+      batch.lengths[gapBegin] = batch.lengths[from];
+      gapBegin++;
+   }
+}
+
+void LILC::LilC_Scanner::flattenTokens()
+{
+   moveGap(batch.size() - gapLength);
+   batch.resize(gapBegin);
+   resetGap();
+}
+
+void LILC::LilC_Scanner::relex(char * base, size_t size, size_t offset,
+size_t removed, size_t inserted)
+{
+   if (batch.size() == 0){
+      scanBuffer(base, size);
+      tokenize();
+      return;
+   }
+   bufferStart = cursor = tokenStart = base;
+   bufferEnd = base + size;
+   batchNext = 0;
+   ownLines.edit(base, offset, removed, inserted);
+
+   const size_t count = tokenCount();
+
+   size_t restart = offset;
+   while (restart > 0 && base[restart - 1] != '\n'){
+      restart--;
+   }
+   // A scan that already stopped before this line stops there still
+   if (tokenOffset(count - 1) < restart){
+      return;
+   }
+   size_t windowEnd = size;
+   size_t resume = offset + inserted;
+   const void * newline = std::memchr(base + resume, '\n', size - resume);
+   if (newline != nullptr){
+      windowEnd = static_cast<const char *>(newline) - base + 1;
+   }
+   size_t oldWindowEnd = windowEnd - inserted + removed;
+
+   // Old tokens [first, last) are on the relexed lines
+   size_t first = firstTokenAt(restart);
+   size_t last = firstTokenAt(oldWindowEnd);
+
+   std::string text(base + restart, windowEnd - restart);
+   text.append(2, '\0');
+   LilC_Scanner part(tokens, names);
+   part.switchToBuffer(&text[0], text.size() - 2);
+   part.lines = lines;
+   part.locBase = static_cast<uint32_t>(restart);
+   part.setBackend(backend);
+   part.setDiagnostics(*diagnostics);
+   part.tokenize();
+   const TokenBuffer &fresh = part.batch;
+   size_t freshCount = fresh.size() - 1;
+   bool stopped = fresh.starts[freshCount] < windowEnd;
+
+   TokenBuffer replacement;
+   if (stopped || windowEnd == size){
+      // The new stream ends in the window, END and all
+      append(replacement, fresh, fresh.size());
+      last = count;
+   } else if (last == count){
+      // The old stream stopped in the window but the new one doesn't
+      append(replacement, fresh, freshCount);
+      LilC_Scanner rest(tokens, names);
+      rest.switchToBuffer(base + windowEnd, size - windowEnd);
+      rest.lines = lines;
+      rest.locBase = static_cast<uint32_t>(windowEnd);
+      rest.setBackend(backend);
+      rest.setDiagnostics(*diagnostics);
+      rest.tokenize();
+      append(replacement, rest.batch, rest.batch.size());
+   } else {
+      append(replacement, fresh, freshCount);
+   }
+
+   // Splice: drop the old tokens into the gap, then fill it from the front
+   moveGap(first);
+   gapLength += last - first;
+   size_t needed = replacement.size();
+   if (needed > gapLength){
+      size_t tail = batch.size() - gapBegin - gapLength;
+      size_t grown = needed + count / 8 + 64;
+      batch.resize(gapBegin + grown + tail);
+      size_t from = gapBegin + gapLength;
+      size_t to = gapBegin + grown;
+      for (size_t i = tail; i-- > 0; ){
+         batch.tags[to + i] = batch.tags[from + i];
+         batch.starts[to + i] = batch.starts[from + i];
+         batch.lengths[to + i] = batch.lengths[from + i];
+      }
+      gapLength = grown;
+   }
+   for (size_t i = 0; i < needed; i++){
+      batch.tags[gapBegin] = replacement.tags[i];
+      batch.starts[gapBegin] = replacement.starts[i];
+      batch.lengths[gapBegin] = replacement.lengths[i];
+      gapBegin++;
+   }
+   gapLength -= needed;
+   if (last == count){
+      // Nothing follows the gap any more
+      batch.resize(gapBegin);
+      resetGap();
+   } else {
+      tailShift += static_cast<uint32_t>(inserted - removed);
+   }
+}
@@ -0,0 +1,187 @@
+/*
+Incremental reparse. The token stream is brought up to date by relex
+(incremental_lexer.cpp), which lexes again just the lines an edit
+touches and keeps every token outside them as it was. A top-level
+declaration none of whose tokens are on those lines therefore parses
+to the same subtree it did before, so it is kept: the tree's own
+nodes, moved only in where they are. The declarations whose tokens
+might be on the relexed lines, from the one the first line starts in
+to the last one starting before the window ends, are cut out of the
+token stream and parsed as a program of their own, as parallel parsing
+parses its chunks (parallel_parser.cpp), and what they parse to takes
+their place in the program's list of declarations.
+
+The cut is between whole declarations on both sides, in the old stream
+and the new, so the edited source is a program exactly when the piece
+is one. Where the piece's syntax error is reported isn't always where a
+whole parse would report it, though: the piece ends at the next
+declaration's first token, which a whole parse may go past. So a piece
+that doesn't parse is kept quiet, and the whole source is parsed again
+to report the error.
+
+Locations are byte offsets, so the nodes of the declarations after the
+edit are moved by its change in length, in a walk that allocates
+nothing and costs far less than parsing them. String literals point
+into the source, so if the edit moved it they are re-pointed too. The
+nodes of the declarations replaced stay in the arena until the next
+parse from a file.
+ */
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <sstream>
+
+#include "lilc_compiler.hpp"
+
+// Make the source an editable copy, if it is still the mapped file,
+// and apply the edit to it
+void LILC::LilC_Compiler::editSource( size_t offset, size_t removed,
+const char * inserted, size_t length )
+{
+   if( source.mapped() ) {
+      // Room to grow, so that the edits to come seldom move the text
+      streamed.reserve( source.size() + source.size() / 8
+                        + SourceBuffer::PADDING + 4096 );
+      streamed.assign( source.data(), source.size() );
+      streamed.append( SourceBuffer::PADDING, '\0' );
+      source.release();
+   } else if( streamed.empty() ) {
+      streamed.assign( SourceBuffer::PADDING, '\0' );
+   }
+   streamed.replace( offset, removed, inserted, length );
+}
+
+// Parse all of the edited source again, from its up to date tokens
+bool LILC::LilC_Compiler::parseEdited()
+{
+   tokens.reset();
+   astRoot = nullptr;
+   nodes.reset();
+   exps.clear();
+   resetParts();
+   flat.clear();
+   image.close();
+   bool parsed = parseTokens();
+   if( parsed && hashes ) {
+      astRoot->structuralHash();
+   }
+   return parsed;
+}
+
+bool LILC::LilC_Compiler::reparse( size_t offset, size_t removed,
+const char * inserted, size_t length )
+{
+   const char * oldText = sourceText();
+   assert( offset + removed
+           <= ( source.mapped() || ! streamed.empty() ? sourceSize() : 0 ) );
+   editSource( offset, removed, inserted, length );
+   char * text = &streamed[0];
+   size_t size = streamed.size() - SourceBuffer::PADDING;
+
+   if( scanner == nullptr ) {
+      startScanner( nullptr );
+      tokenizeInput();
+      return parseEdited();
+   }
+   // A pipelined parse leaves no token stream behind to relex
+   if( astRoot == nullptr || astRoot->declList()->decls().empty()
+       || exps.sharing() || scanner->tokenCount() == 0 ) {
+      scanner->relex( text, size, offset, removed, length );
+      return parseEdited();
+   }
+
+   // The lines relex lexes again, [restart, windowEnd) in the new text
+   // and [restart, oldWindowEnd) in the old
+   size_t restart = offset;
+   while( restart > 0 && text[restart - 1] != '\n' ) {
+      restart--;
+   }
+   size_t windowEnd = size;
+   size_t resume = offset + length;
+   const void * newline = std::memchr( text + resume, '\n', size - resume );
+   if( newline != nullptr ) {
+      windowEnd = static_cast<const char *>( newline ) - text + 1;
+   }
+   size_t oldWindowEnd = windowEnd - length + removed;
+
+   // Declarations [first, last) are parsed again
+   DeclListNode * list = astRoot->declList();
+   NodeArray<DeclNode *> decls = list->decls();
+   const size_t count = decls.size();
+   size_t first = std::upper_bound( decls.begin(), decls.end(), restart,
+      []( size_t at, const DeclNode * d ){ return at < d->loc().offset; } )
+      - decls.begin();
+   first = first == 0 ? 0 : first - 1;
+   size_t last = std::lower_bound( decls.begin(), decls.end(), oldWindowEnd,
+      []( const DeclNode * d, size_t at ){ return d->loc().offset < at; } )
+      - decls.begin();
+   last = std::max( last, first + 1 );
+   size_t pieceStart = std::min<size_t>( restart, decls[first]->loc().offset );
+   size_t keptAt = last < count ? decls[last]->loc().offset : size;
+   size_t keptTokens = last < count
+      ? scanner->tokenCount() - scanner->firstTokenAt( keptAt ) : 0;
+
+   scanner->relex( text, size, offset, removed, length );
+   const int64_t delta = static_cast<int64_t>( length )
+                       - static_cast<int64_t>( removed );
+   size_t begin = scanner->firstTokenAt( pieceStart );
+   size_t end = scanner->tokenCount() - 1;
+   if( last < count ) {
+      end = scanner->firstTokenAt( keptAt + delta );
+      // A string literal error in the relexed lines ends the scan
+      // there, and the declarations after them with it
+      if( scanner->tokenCount() - end != keptTokens ) {
+         return parseEdited();
+      }
+   }
+
+   Arena pieceTokens;
+   LilC_Scanner part( pieceTokens, names );
+   part.followTokens( *scanner, begin, end, nullptr );
+   // The piece's error may not be the whole parse's: its END stands
+   // where the next declaration starts
+   std::ostringstream syntaxErrors;
+   part.setDiagnostics( syntaxErrors );
+   ProgramNode * piece = nullptr;
+   if( ! parseWith( part, piece, nodes, exps ) ) {
+      return parseEdited();
+   }
+
+   if( text != oldText ) {
+      for( size_t i = 0; i < first; i++ ) {
+         decls[i]->relocate( 0, text );
+      }
+   }
+   if( text != oldText || delta != 0 ) {
+      for( size_t i = last; i < count; i++ ) {
+         decls[i]->relocate( delta, text );
+      }
+   }
+   NodeArray<DeclNode *> fresh = piece->declList()->decls();
+   if( hashes ) {
+      for( DeclNode * decl : fresh ) {
+         decl->structuralHash();
+      }
+   }
+
+   // As many declarations as before, the usual case, go where the old
+   // ones were; otherwise the program gets a new list
+   if( fresh.size() == last - first ) {
+      std::copy( fresh.begin(), fresh.end(), decls.begin() + first );
+      return true;
+   }
+   NodeList<DeclNode *> joined( nodes );
+   joined.reserve( count - ( last - first ) + fresh.size() );
+   for( size_t i = 0; i < first; i++ ) {
+      joined.push_back( decls[i] );
+   }
+   for( DeclNode * decl : fresh ) {
+      joined.push_back( decl );
+   }
+   for( size_t i = last; i < count; i++ ) {
+      joined.push_back( decls[i] );
+   }
+   astRoot = nodes.make<ProgramNode>( astRoot->loc(),
+      nodes.make<DeclListNode>( list->loc(), std::move( joined ) ) );
+   return true;
+}
@@ -0,0 +1,62 @@
+#include <cstring>
+
+#include "interner.hpp"
+
+uint64_t LILC::Interner::hashBytes(const char * chars, size_t length)
+{
+   // 64-bit FNV-1a
+   uint64_t hash = 14695981039346656037ULL;
+   for (size_t i = 0; i < length; i++){
+      hash ^= static_cast<unsigned char>(chars[i]);
+      hash *= 1099511628211ULL;
+   }
+   return hash;
+}
+
+LILC::Atom LILC::Interner::intern(const char * chars, size_t length)
+{
+   if (slots.empty()){
+      slots.assign(256, nullptr);
+   }
+   uint64_t hash = hashBytes(chars, length);
+   size_t mask = slots.size() - 1;
+   size_t i = static_cast<size_t>(hash) & mask;
+   while (const Atom::Entry * e = slots[i]){
+      if (e->hash == hash && e->length == length
+          && std::memcmp(e->chars, chars, length) == 0){
+         return Atom(e);
+      }
+      i = (i + 1) & mask;
+   }
+
+   char * copy = static_cast<char *>(storage.allocate(length + 1, 1));
+   std::memcpy(copy, chars, length);
+   copy[length] = '\0';
+   Atom::Entry * entry = storage.make<Atom::Entry>();
+   entry->chars = copy;
+   entry->length = static_cast<uint32_t>(length);
+   entry->id = static_cast<uint32_t>(count);
+   entry->hash = hash;
+   slots[i] = entry;
+
+   // Keep the load factor under one half
+   if (++count * 2 > slots.size()){
+      rehash();
+   }
+   return Atom(entry);
+}
+
+void LILC::Interner::rehash()
+{
+   std::vector<const Atom::Entry *> old(slots.size() * 2, nullptr);
+   old.swap(slots);
+   size_t mask = slots.size() - 1;
+   for (const Atom::Entry * e : old){
+      if (e == nullptr){ continue; }
+      size_t i = static_cast<size_t>(e->hash) & mask;
+      while (slots[i] != nullptr){
+         i = (i + 1) & mask;
+      }
+      slots[i] = e;
+   }
+}
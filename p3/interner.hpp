@@ -0,0 +1,88 @@
+#ifndef __LILC_INTERNER_HPP__
+#define __LILC_INTERNER_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+#include "arena.hpp"
+
+namespace LILC{
+
+class Interner;
+
+/*
+Handle to an identifier spelling owned by an Interner. Two atoms from
+the same interner are equal exactly when their spellings are, so
+comparing or hashing one is a single word operation. An atom stays
+valid for as long as the interner that produced it.
+ */
+class Atom{
+public:
+	Atom() = default;
+
+	const char * c_str() const { return entry->chars; }
+	size_t size() const { return entry->length; }
+	// Dense id, 0 for the first atom of an interner
+	uint32_t id() const { return entry->id; }
+	// Hash of the spelling only, so it is stable across interners
+	uint64_t hash() const { return entry->hash; }
+	bool valid() const { return entry != nullptr; }
+
+	bool operator==(Atom other) const { return entry == other.entry; }
+	bool operator!=(Atom other) const { return entry != other.entry; }
+private:
+	friend class Interner;
+	struct Entry{
+		const char * chars;
+		uint32_t length;
+		uint32_t id;
+		uint64_t hash;
+	};
+	explicit Atom(const Entry * e) : entry(e) {}
+
+	const Entry * entry = nullptr;
+};
+
+inline std::ostream & operator<<(std::ostream & out, Atom atom){
+	return out.write(atom.c_str(), atom.size());
+}
+
+/*
+Maps identifier spellings to atoms. Spellings and entries are copied
+into the interner's own arena the first time they are seen; looking up
+a spelling that is already present does not allocate.
+ */
+class Interner{
+public:
+	Interner() = default;
+	Interner(const Interner&) = delete;
+	Interner& operator=(const Interner&) = delete;
+
+	Atom intern(const char * chars, size_t length);
+	size_t size() const { return count; }
+
+	static uint64_t hashBytes(const char * chars, size_t length);
+private:
+	void rehash();
+
+	Arena storage;
+	// Open addressing, linear probing; size is always a power of two
+	std::vector<const Atom::Entry *> slots;
+	size_t count = 0;
+};
+
+} /* end namespace */
+
+namespace std{
+template <>
+struct hash<LILC::Atom>{
+	size_t operator()(LILC::Atom atom) const {
+		return static_cast<size_t>(atom.hash());
+	}
+};
+}
+
+#endif /* END __LILC_INTERNER_HPP__ */
@@ -6,11 +6,14 @@
 %define parser_class_name {LilC_Parser}
 %output "lilc_parser.cc"
 %token-table
+%locations
+%define api.location.type {LILC::SourceLoc}
 
 %code requires{
-   #include <list>
    #include "symbols.hpp"
    #include "ast.hpp"
+   #include "exp_table.hpp"
+   #include "source_loc.hpp"
    namespace LILC {
       class LilC_Compiler;
       class LilC_Scanner;
@@ -28,7 +31,9 @@
 }
 
 %parse-param { LilC_Scanner  &scanner  }
-%parse-param { LilC_Compiler &compiler }
+%parse-param { ProgramNode * &root    }
+%parse-param { Arena         &nodes    }
+%parse-param { ExpTable      &exps     }
 
 %code{
    #include <iostream>
@@ -38,36 +43,20 @@
    /* include for interoperation between scanner/parser */
    #include "lilc_compiler.hpp"
 
+/* tokens come from the stream LilC_Scanner::tokenize recorded */
 #undef yylex
-#define yylex scanner.yylex
-}
+#define yylex scanner.bufferedLex
 
-/*%define api.value.type variant*/
-%union {
-	int intVal;
-	std::string * strVal;
-	LILC::SynSymbol * symbolValue;
-	LILC::IDToken * idTokenValue;
-	LILC::ASTNode * astNode;
-	LILC::ProgramNode * programNode;
-	std::list<DeclNode *> * declList;
-	LILC::DeclNode * declNode;
-	LILC::VarDeclNode * varDeclNode;
-  LILC::FnDeclNode * fnDeclNode;
-	LILC::StructDeclNode * structDeclNode;
-	LILC::TypeNode * typeNode;
-	LILC::IdNode * idNode;
-  std::list<StmtNode*> * stmtListNode;
-  LILC::StmtNode * stmtNode;
-  std::list<FormalDeclNode *> * formalsListNode;
-  LILC::FormalDeclNode * formalsDecl;
-  LILC::FnBodyNode * fnBodyNode;
-  LILC::ExpNode * expNode;
-  LILC::AssignNode * assignNode;
-  std::list<ExpNode *> * expNodeList;
-	/*LILC::Token * token;*/
+/* a location is just where the first symbol of the rule starts; an
+   empty rule gets the start of the symbol before it */
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+   (Current) = (N) ? YYRHSLOC(Rhs, 1) : YYRHSLOC(Rhs, 0)
 }
 
+/* Semantic values are typed, and child lists are NodeList values that
+   are moved from rule to rule while they grow, never copied */
+%define api.value.type variant
+
 %define parse.assert
 
 %token               END    0     "end of file"
@@ -85,9 +74,9 @@
 %token               ELSE
 %token               WHILE
 %token               RETURN
-%token <idTokenValue> ID
-%token <intVal>      INTLITERAL
-%token <strVal>      STRINGLITERAL
+%token <LILC::IDToken *> ID
+%token <LILC::IntLitToken *> INTLITERAL
+%token <LILC::StringLitToken *> STRINGLITERAL
 %token               LCURLY
 %token               RCURLY
 %token               LPAREN
@@ -128,28 +117,28 @@
 *  to this list as you add productions to the grammar
 *  below.
 */
-%type <programNode> program
-%type <declList> declList
-%type <declNode> decl
-%type <varDeclNode> varDecl
-%type <declList> structBody
-%type <structDeclNode> structDecl
-%type <fnDeclNode> fnDecl
-%type <fnBodyNode> fnBody
-%type <formalsListNode> formals
-%type <formalsListNode> formalsList
-%type <formalsDecl> formalDecl
-%type <declList> varDeclList
-%type <stmtListNode> stmtList
-%type <stmtNode> stmt
-%type <typeNode> type
-%type <idNode> id
-%type <assignNode> assignExp
-%type <expNode> exp
-%type <expNode> term
-%type <expNode> fncall
-%type <expNodeList> actualList
-%type <expNode> loc
+%type <LILC::ProgramNode *> program
+%type <LILC::NodeList<LILC::DeclNode *>> declList
+%type <LILC::DeclNode *> decl
+%type <LILC::VarDeclNode *> varDecl
+%type <LILC::NodeList<LILC::DeclNode *>> structBody
+%type <LILC::StructDeclNode *> structDecl
+%type <LILC::FnDeclNode *> fnDecl
+%type <LILC::FnBodyNode *> fnBody
+%type <LILC::NodeList<LILC::FormalDeclNode *>> formals
+%type <LILC::NodeList<LILC::FormalDeclNode *>> formalsList
+%type <LILC::FormalDeclNode *> formalDecl
+%type <LILC::NodeList<LILC::DeclNode *>> varDeclList
+%type <LILC::NodeList<LILC::StmtNode *>> stmtList
+%type <LILC::StmtNode *> stmt
+%type <LILC::TypeNode *> type
+%type <LILC::IdNode *> id
+%type <LILC::AssignNode *> assignExp
+%type <LILC::ExpNode *> exp
+%type <LILC::ExpNode *> term
+%type <LILC::ExpNode *> fncall
+%type <LILC::NodeList<LILC::ExpNode *>> actualList
+%type <LILC::ExpNode *> loc
 
 
 /* NOTE: Make sure to add precedence and associativity
@@ -159,18 +148,18 @@
 %%
 
 program : declList {
-		   //$$ = new ProgramNode(new DeclListNode($1));
-		   $$ = new ProgramNode(new DeclListNode($1));
-		   compiler.setASTRoot($$);
+		   //$$ = nodes.make<ProgramNode>(@$, nodes.make<DeclListNode>(@1, std::move($1)));
+		   $$ = nodes.make<ProgramNode>(@$, nodes.make<DeclListNode>(@1, std::move($1)));
+		   root = $$;
 		   }
   	;
 
 declList : declList decl {
-			 $1->push_back($2);
-			 $$ = $1;
+			 $$ = std::move($1);
+			 $$.push_back($2);
 			 }
 	| /* epsilon */ {
-			$$ = new std::list<DeclNode *>();
+			$$ = NodeList<DeclNode *>(nodes);
 			}
 	;
 
@@ -180,127 +169,124 @@ decl : varDecl { $$ = $1; }
 ;
 
 varDeclList : varDeclList varDecl {
-				$1->push_back($2);
-				$$=$1;
+				$$ = std::move($1);
+				$$.push_back($2);
 				}
-	| /* epsilon */ { $$ = new std::list<DeclNode *>(); }
+	| /* epsilon */ { $$ = NodeList<DeclNode *>(nodes); }
 ;
 
 varDecl : type id SEMICOLON {
-		$$ = new VarDeclNode($1, $2, VarDeclNode::NOT_STRUCT);
+		$$ = nodes.make<VarDeclNode>(@$, $1, $2, VarDeclNode::NOT_STRUCT);
 			    }
-          | STRUCT id id SEMICOLON { $$ = new VarDeclNode(new StructNode($2), $3, 1); }
+          | STRUCT id id SEMICOLON { $$ = nodes.make<VarDeclNode>(@$, nodes.make<StructNode>(@2, $2), $3, 1); }
 ;
 
-fnDecl : type id formals fnBody { $$ = new FnDeclNode($1, $2, new FormalsListNode($3), $4); } ;
-formals : LPAREN RPAREN { $$ = new std::list<FormalDeclNode *>(); }
-          | LPAREN formalsList RPAREN { $$ = $2; }
+fnDecl : type id formals fnBody { $$ = nodes.make<FnDeclNode>(@$, $1, $2, nodes.make<FormalsListNode>(@3, std::move($3)), $4); } ;
+formals : LPAREN RPAREN { $$ = NodeList<FormalDeclNode *>(nodes); }
+          | LPAREN formalsList RPAREN { $$ = std::move($2); }
 ;
 
 formalsList : formalDecl {
-              std::list<FormalDeclNode *> * lFormal = new std::list<FormalDeclNode *>();
-              lFormal->push_back($1);
-              $$ = lFormal;
+              $$ = NodeList<FormalDeclNode *>(nodes);
+              $$.push_back($1);
           }
           | formalDecl COMMA formalsList {
-              $3->push_back($1);
-              $$ = $3;
+              $$ = std::move($3);
+              $$.push_back($1);
           }
 ;
 
-formalDecl : type id { $$ = new FormalDeclNode($1, $2); } ;
+formalDecl : type id { $$ = nodes.make<FormalDeclNode>(@$, $1, $2); } ;
 
 structDecl : STRUCT id LCURLY structBody RCURLY SEMICOLON {
-    $$ = new StructDeclNode(new DeclListNode($4), $2);
+    $$ = nodes.make<StructDeclNode>(@$, nodes.make<DeclListNode>(@4, std::move($4)), $2);
           }
 ;
 
 structBody : structBody varDecl {
-    $1->push_back($2);
-    $$ = $1;
+    $$ = std::move($1);
+    $$.push_back($2);
  }
                 | varDecl {
-    std::list<DeclNode*>* list = new std::list<DeclNode*>();
-    list->push_back($1);
-    $$ = list;
+    $$ = NodeList<DeclNode *>(nodes);
+    $$.push_back($1);
                 }
 ;
 
-fnBody : LCURLY varDeclList stmtList RCURLY { $$ = new FnBodyNode(new DeclListNode($2), new StmtListNode($3)); } ;
+fnBody : LCURLY varDeclList stmtList RCURLY { $$ = nodes.make<FnBodyNode>(@$, nodes.make<DeclListNode>(@2, std::move($2)), nodes.make<StmtListNode>(@3, std::move($3))); } ;
 stmtList : stmtList stmt {
-    $1->push_back($2);
-    $$ = $1;
+    $$ = std::move($1);
+    $$.push_back($2);
 }
-  | /* epsilon */ { $$ = new std::list<StmtNode *>(); }
+  | /* epsilon */ { $$ = NodeList<StmtNode *>(nodes); }
 ;
 
-stmt : assignExp SEMICOLON {$$ = new AssignStmtNode($1);} ;
-  | loc PLUSPLUS SEMICOLON { $$ = new PostIncStmtNode($1); }
-  | loc MINUSMINUS SEMICOLON { $$ = new PostDecStmtNode($1); }
-  | INPUT READ loc SEMICOLON { $$ = new ReadStmtNode($3); }
-	| OUTPUT WRITE exp SEMICOLON { $$ = new WriteStmtNode($3); }
-  | IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = new IfStmtNode($3, new DeclListNode($6), new StmtListNode($7)); }
-  | IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY ELSE LCURLY varDeclList stmtList RCURLY { $$ = new IfElseStmtNode($3, new DeclListNode($6), new StmtListNode($7), new DeclListNode($11), new StmtListNode($12)); }
-  | WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = new WhileStmtNode($3, new DeclListNode($6), new StmtListNode($7)); }
-  | WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = new WhileStmtNode($3, new DeclListNode($6), new StmtListNode($7));}
-	| RETURN exp SEMICOLON { $$ = new ReturnStmtNode($2); }
-	| RETURN SEMICOLON { $$ = new ReturnStmtNode(nullptr);}
-	| fncall SEMICOLON { $$ = new CallStmtNode($1); }
-
-assignExp : loc ASSIGN exp { $$ = new AssignNode($1, $3);} ;
+stmt : assignExp SEMICOLON {$$ = nodes.make<AssignStmtNode>(@$, $1);} ;
+  | loc PLUSPLUS SEMICOLON { $$ = nodes.make<PostIncStmtNode>(@$, $1); }
+  | loc MINUSMINUS SEMICOLON { $$ = nodes.make<PostDecStmtNode>(@$, $1); }
+  | INPUT READ loc SEMICOLON { $$ = nodes.make<ReadStmtNode>(@$, $3); }
+	| OUTPUT WRITE exp SEMICOLON { $$ = nodes.make<WriteStmtNode>(@$, $3); }
+  | IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = nodes.make<IfStmtNode>(@$, $3, nodes.make<DeclListNode>(@6, std::move($6)), nodes.make<StmtListNode>(@7, std::move($7))); }
+  | IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY ELSE LCURLY varDeclList stmtList RCURLY { $$ = nodes.make<IfElseStmtNode>(@$, $3, nodes.make<DeclListNode>(@6, std::move($6)), nodes.make<StmtListNode>(@7, std::move($7)), nodes.make<DeclListNode>(@11, std::move($11)), nodes.make<StmtListNode>(@12, std::move($12))); }
+  | WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = nodes.make<WhileStmtNode>(@$, $3, nodes.make<DeclListNode>(@6, std::move($6)), nodes.make<StmtListNode>(@7, std::move($7))); }
+  | WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY { $$ = nodes.make<WhileStmtNode>(@$, $3, nodes.make<DeclListNode>(@6, std::move($6)), nodes.make<StmtListNode>(@7, std::move($7)));}
+	| RETURN exp SEMICOLON { $$ = nodes.make<ReturnStmtNode>(@$, $2); }
+	| RETURN SEMICOLON { $$ = nodes.make<ReturnStmtNode>(@$, nullptr);}
+	| fncall SEMICOLON { $$ = nodes.make<CallStmtNode>(@$, $1); }
+
+assignExp : loc ASSIGN exp { $$ = nodes.make<AssignNode>(@$, $1, $3);} ;
 
 exp : assignExp { $$ = $1; }
-  | exp PLUS exp { $$ = new PlusNode($1, $3); }
-  | exp MINUS exp { $$ = new MinusNode($1, $3); }
-  | exp TIMES exp { $$ = new TimesNode($1, $3); }
-  | exp DIVIDE exp { $$ = new DivideNode($1, $3); }
-  | NOT exp %prec UNARYPREC { $$ = new NotNode($2); }
-  | exp AND exp { $$ = new AndNode($1, $3); }
-  | exp OR exp { $$ = new OrNode($1, $3); }
-  | exp EQUALS exp { $$ = new EqualsNode($1, $3); }
-  | exp NOTEQUALS exp { $$ = new NotEqualsNode($1, $3); }
-  | exp LESS exp { $$ = new LessNode($1, $3); }
-  | exp GREATER exp { $$ = new GreaterNode($1, $3); }
-  | exp LESSEQ exp { $$ = new LessEqNode($1, $3); }
-  | exp GREATEREQ exp { $$ = new GreaterEqNode($1, $3); }
-  | MINUS term %prec UNARYPREC { $$ = new UnaryMinusNode($2); }
+  | exp PLUS exp { $$ = exps.make<PlusNode>(@$, $1, $3); }
+  | exp MINUS exp { $$ = exps.make<MinusNode>(@$, $1, $3); }
+  | exp TIMES exp { $$ = exps.make<TimesNode>(@$, $1, $3); }
+  | exp DIVIDE exp { $$ = exps.make<DivideNode>(@$, $1, $3); }
+  | NOT exp %prec UNARYPREC { $$ = exps.make<NotNode>(@$, $2); }
+  | exp AND exp { $$ = exps.make<AndNode>(@$, $1, $3); }
+  | exp OR exp { $$ = exps.make<OrNode>(@$, $1, $3); }
+  | exp EQUALS exp { $$ = exps.make<EqualsNode>(@$, $1, $3); }
+  | exp NOTEQUALS exp { $$ = exps.make<NotEqualsNode>(@$, $1, $3); }
+  | exp LESS exp { $$ = exps.make<LessNode>(@$, $1, $3); }
+  | exp GREATER exp { $$ = exps.make<GreaterNode>(@$, $1, $3); }
+  | exp LESSEQ exp { $$ = exps.make<LessEqNode>(@$, $1, $3); }
+  | exp GREATEREQ exp { $$ = exps.make<GreaterEqNode>(@$, $1, $3); }
+  | MINUS term %prec UNARYPREC { $$ = exps.make<UnaryMinusNode>(@$, $2); }
   | term { $$ = $1; }
 ;
 
 term : loc { $$ = $1; }
-  | INTLITERAL { $$ = new IntLitNode($1); }
-  | STRINGLITERAL { $$ = new StrLitNode($1); }
-  | TRUE { $$ = new TrueNode(); }
-  | FALSE { $$ = new FalseNode(); }
+  | INTLITERAL { $$ = exps.make<IntLitNode>(@$, $1->value()); }
+  | STRINGLITERAL { $$ = nodes.make<StrLitNode>($1); }
+  | TRUE { $$ = nodes.make<TrueNode>(@$); }
+  | FALSE { $$ = nodes.make<FalseNode>(@$); }
   | LPAREN exp RPAREN { $$ = $2; }
   | fncall { $$ = $1; }
 ;
 
-fncall : id LPAREN RPAREN { $$ = new CallExpNode($1, new ExpListNode(new std::list<ExpNode *>())); }
-  | id LPAREN actualList RPAREN { $$ = new CallExpNode($1, new ExpListNode($3)); }
+fncall : id LPAREN RPAREN { $$ = nodes.make<CallExpNode>(@$, $1, nodes.make<ExpListNode>(@3, NodeList<ExpNode *>(nodes))); }
+  | id LPAREN actualList RPAREN { $$ = nodes.make<CallExpNode>(@$, $1, nodes.make<ExpListNode>(@3, std::move($3))); }
 ;
 
 actualList : exp {
-              std::list<ExpNode *> nodeList;
-              nodeList.push_front($1);
-              $$ = &nodeList;
+              $$ = NodeList<ExpNode *>(nodes);
+              $$.push_front($1);
               }
-  | actualList COMMA exp { $1->push_front($3); $$ = $1; }
+  | actualList COMMA exp { $$ = std::move($1); $$.push_front($3); }
 ;
 
-type : INT { $$ = new IntNode(); }
-  | BOOL { $$ = new BoolNode(); }
-  | VOID { $$ = new VoidNode(); }
+type : INT { $$ = nodes.make<IntNode>(@$); }
+  | BOOL { $$ = nodes.make<BoolNode>(@$); }
+  | VOID { $$ = nodes.make<VoidNode>(@$); }
 ;
 
 loc : id { $$ = $1; }
-  | loc DOT id { $$ = new DotAccessNode($1, $3); }
+  | loc DOT id { $$ = exps.make<DotAccessNode>(@$, $1, $3); }
 ;
 
-id : ID { $$ = new IdNode($1); } ;
+id : ID { $$ = exps.make<IdNode>($1); } ;
 %%
 void
-LILC::LilC_Parser::error(const std::string &err_message )
+LILC::LilC_Parser::error(const location_type &l, const std::string &err_message )
 {
-   std::cerr << "Error: " << err_message << "\n";
+   scanner.error(l, err_message);
 }
@@ -1,8 +1,12 @@
 #include <cctype>
+#include <cstdio>
 #include <fstream>
 #include <cassert>
+#include <iterator>
 
 #include "lilc_compiler.hpp"
+#include "descent_parser.hpp"
+#include "output_buffer.hpp"
 
 using TokenTag = LILC::LilC_Parser::token;
 using Lexeme = LILC::LilC_Parser::semantic_type;
@@ -13,196 +17,337 @@ LILC::LilC_Compiler::~LilC_Compiler()
    scanner = nullptr;
    delete(parser);
    parser = nullptr;
+   delete(pool);
+   pool = nullptr;
+   for( Arena * part : partNodes ) {
+      delete(part);
+   }
+}
+
+/*
+Read filename into memory. Regular files are memory-mapped; anything
+that can't be mapped (pipes, character devices, empty files) is read
+into a buffer instead, so every compilation has the whole source in
+memory and every token a byte offset into it. Starting a new
+compilation ends the previous one, so its tokens and AST are released
+here.
+ */
+void LILC::LilC_Compiler::openSource( const char * const filename )
+{
+   delete(scanner);
+   scanner = nullptr;
+   source.release();
+   streamed.clear();
+   tokens.reset();
+   astRoot = nullptr;
+   nodes.reset();
+   exps.clear();
+   resetParts();
+   flat.clear();
+   image.close();
+
+   if( ! source.map( filename ) ) {
+      readStream( filename );
+   }
+}
+
+void LILC::LilC_Compiler::readStream( const char * const filename )
+{
+   std::ifstream stream( filename );
+   if( ! stream.good() ) {
+       exit( EXIT_FAILURE );
+   }
+   streamed.assign( std::istreambuf_iterator<char>( stream ),
+                    std::istreambuf_iterator<char>() );
+   streamed.append( SourceBuffer::PADDING, '\0' );
+}
+
+const char * LILC::LilC_Compiler::sourceText() const
+{
+   return source.mapped() ? source.data() : streamed.data();
+}
+
+size_t LILC::LilC_Compiler::sourceSize() const
+{
+   return source.mapped() ? source.size()
+                          : streamed.size() - SourceBuffer::PADDING;
+}
+
+// Set up a fresh scanner over the source openSource read in
+void LILC::LilC_Compiler::startScanner( const char * const filename )
+{
+   scanner = new LILC::LilC_Scanner( tokens, names );
+   scanner->setBackend( lexer );
+   if( source.mapped() ) {
+      if( scanner->scanBuffer( source.data(), source.size() ) ) {
+         return;
+      }
+      source.release();
+      readStream( filename );
+   }
+   if( ! scanner->scanBuffer( &streamed[0],
+                              streamed.size() - SourceBuffer::PADDING ) ) {
+      exit( EXIT_FAILURE );
+   }
+}
+
+void LILC::LilC_Compiler::openScanner( const char * const filename )
+{
+   openSource( filename );
+   startScanner( filename );
+}
+
+std::string LILC::LilC_Compiler::imagePath( uint64_t sourceHash ) const
+{
+   char name[32];
+   snprintf( name, sizeof(name), "/%016llx.lilast",
+             static_cast<unsigned long long>( sourceHash ) );
+   return cacheDir + name;
+}
+
+LILC::ThreadPool & LILC::LilC_Compiler::threadPool( size_t threads )
+{
+   if( pool == nullptr || pool->size() != threads ) {
+      delete(pool);
+      pool = new LILC::ThreadPool( threads );
+   }
+   return *pool;
+}
+
+// Release the nodes of the chunks parsed in parallel, keeping their
+// arenas for the next parse
+void LILC::LilC_Compiler::resetParts()
+{
+   for( Arena * part : partNodes ) {
+      part->reset();
+   }
+}
+
+// Fill the scanner's token buffer, in parallel if asked to
+void LILC::LilC_Compiler::tokenizeInput()
+{
+   if( lexThreads > 1 ) {
+      scanner->tokenizeParallel( threadPool( lexThreads ) );
+   } else {
+      scanner->tokenize();
+   }
 }
 
 void LILC::LilC_Compiler::scan( const char * const filename,
 const char * outfile )
 {
 
-   std::ifstream inStream( filename );
-   if( ! inStream.good() ) {
-       exit( EXIT_FAILURE );
+   // Lexing in parallel produces the whole token stream up front,
+   // which is then dumped exactly as if read token by token
+   bool batched = lexThreads > 1;
+   openScanner( filename );
+   if( batched ) {
+      tokenizeInput();
    }
+   dumpTokens( batched, outfile );
+}
 
-   delete(scanner);
-   scanner = new LILC::LilC_Scanner( &inStream );
+void LILC::LilC_Compiler::rescan( size_t offset, size_t removed,
+const char * inserted, size_t length )
+{
+   // scan read its tokens one at a time, leaving none to relex
+   if( scanner != nullptr && scanner->tokenCount() == 0 ) {
+      delete(scanner);
+      scanner = nullptr;
+      startScanner( nullptr );
+      tokenizeInput();
+   }
+   assert( offset + removed
+           <= ( source.mapped() || ! streamed.empty() ? sourceSize() : 0 ) );
+   editSource( offset, removed, inserted, length );
+   char * text = &streamed[0];
+   size_t size = streamed.size() - SourceBuffer::PADDING;
+   if( scanner == nullptr ) {
+      startScanner( nullptr );
+      tokenizeInput();
+      return;
+   }
+   scanner->relex( text, size, offset, removed, length );
+}
 
-   std::ofstream out(outfile);
+void LILC::LilC_Compiler::writeTokens( const char * outfile )
+{
+   assert( scanner != nullptr );
+   dumpTokens( true, outfile );
+}
+
+void LILC::LilC_Compiler::unparse( const char * outfile )
+{
+   assert( astRoot != nullptr );
+   unparseTo( *this->astRoot, outfile );
+}
+
+// Write the scanner's tokens to outfile, read from the token stream
+// when batched and lexed one at a time otherwise
+void LILC::LilC_Compiler::dumpTokens( bool batched, const char * outfile )
+{
+   std::ofstream out(outfile, std::ios::binary);
+   TokenDump dump(out, dumpFormat);
    Lexeme lexeme;
    int tokenTag;
    while(true){
-   	tokenTag = scanner->yylex(&lexeme);
+   	tokenTag = batched ? scanner->bufferedLex(&lexeme)
+	                   : scanner->yylex(&lexeme);
 	switch (tokenTag){
-		case TokenTag::END:
-			out << "EOF" << std::endl;
-			return;
-		case TokenTag::BOOL:
-			out << "bool" << std::endl;
-			break;
-		case TokenTag::INT:
-			out << "int" << std::endl;
-			break;
-		case TokenTag::VOID:
-			out << "void" << std::endl;
-			break;
-		case TokenTag::TRUE:
-			out << "true" << std::endl;
-			break;
-		case TokenTag::FALSE:
-			out << "false" << std::endl;
-			break;
-		case TokenTag::STRUCT:
-			out << "struct" << std::endl;
-			break;
-		case TokenTag::INPUT:
-			out << "input" << std::endl;
-			break;
-		case TokenTag::OUTPUT:
-			out << "output" << std::endl;
-			break;
-		case TokenTag::IF:
-			out << "if" << std::endl;
-			break;
-		case TokenTag::ELSE:
-			out << "else" << std::endl;
-			break;
-		case TokenTag::WHILE:
-			out << "while" << std::endl;
-			break;
-		case TokenTag::RETURN:
-			out << "return" << std::endl;
-			break;
 		case TokenTag::ID:
 			{
-			IDToken * tok = (IDToken *)lexeme.symbolValue;
-			out << "ID:" << tok->value() << std::endl;
+			Atom name = lexeme.as<IDToken *>()->value();
+			dump.id(name.c_str(), name.size());
 			break;
 			}
 		case TokenTag::INTLITERAL:
-			{
-			IntLitToken * tok = (IntLitToken *)lexeme.symbolValue;
-			out << "INTLIT:" << tok->value() << std::endl;	
+			dump.intLit(lexeme.as<IntLitToken *>()->value());
 			break;
-			}
 		case TokenTag::STRINGLITERAL:
 			{
-			StringLitToken * tok = (StringLitToken *)lexeme.symbolValue;
-			out << "STRINGLIT:" << tok->value() << std::endl;	
+			StringLitToken * literal = lexeme.as<StringLitToken *>();
+			dump.stringLit(literal->text(), literal->length());
 			break;
 			}
-		case TokenTag::LCURLY:
-			out << "{" << std::endl;
-			break;
-		case TokenTag::RCURLY:
-			out << "}" << std::endl;
-			break;
-		case TokenTag::LPAREN:
-			out << "(" << std::endl;
-			break;
-		case TokenTag::RPAREN:
-			out << ")" << std::endl;
-			break;
-		case TokenTag::SEMICOLON:
-			out << ";" << std::endl;
-			break;
-		case TokenTag::COMMA:
-			out << "," << std::endl;
-			break;
-		case TokenTag::DOT:
-			out << "." << std::endl;
-			break;
-		case TokenTag::WRITE:
-			out << "<<" << std::endl;
-			break;
-		case TokenTag::READ:
-			out << ">>" << std::endl;
-			break;
-		case TokenTag::PLUSPLUS:
-			out << "++" << std::endl;
-			break;
-		case TokenTag::MINUSMINUS:
-			out << "--" << std::endl;
-			break;
-		case TokenTag::PLUS:
-			out << "+" << std::endl;
-			break;
-		case TokenTag::MINUS:
-			out << "-" << std::endl;
-			break;
-		case TokenTag::TIMES:
-			out << "*" << std::endl;
-			break;
-		case TokenTag::DIVIDE:
-			out << "/" << std::endl;
-			break;
-		case TokenTag::NOT:
-			out << "!" << std::endl;
-			break;
-		case TokenTag::AND:
-			out << "&&" << std::endl;
-			break;
-		case TokenTag::OR:
-			out << "||" << std::endl;
-			break;
-		case TokenTag::EQUALS:
-			out << "==" << std::endl;
-			break;
-		case TokenTag::NOTEQUALS:
-			out << "!=" << std::endl;
-			break;
-		case TokenTag::LESS:
-			out << "<" << std::endl;
-			break;
-		case TokenTag::GREATER:
-			out << ">" << std::endl;
-			break;
-		case TokenTag::LESSEQ:
-			out << ">=" << std::endl;
-			break;
-		case TokenTag::GREATEREQ:
-			out << ">=" << std::endl;
-			break;
-		case TokenTag::ASSIGN:
-			out << "=" << std::endl;
-			break;
 		default:
-			out << "UNKNOWN TOKEN" << std::endl;
+			dump.token(tokenTag);
 			break;
 	}
+	LilC_Scanner::clearValue(tokenTag, lexeme);
+	if (tokenTag == TokenTag::END){
+		return;
+	}
    }
 }
 
-void 
-LILC::LilC_Compiler::parse( const char * const filename, const char * const outfile )
+// Parse the scanner's token stream into astRoot; false, with the
+// errors reported, if it isn't a program
+bool LILC::LilC_Compiler::parseTokens()
 {
-   assert( filename != nullptr );
-   std::ifstream in_stream( filename );
-   if( ! in_stream.good() )
+   // Shared expressions need the one table for the whole program, so
+   // sharing parses sequentially; so does anything parallel parsing
+   // gives up on, errors included
+   bool parsed = parseThreads > 1 && ! exps.sharing()
+      && parseInParallel( threadPool( parseThreads ) );
+   if( ! parsed && parserBackend == ParserBackend::DESCENT )
    {
-       exit( EXIT_FAILURE );
+      parsed = parseWith( *scanner, astRoot, nodes, exps );
    }
-   std::ofstream out(outfile);
-   
-   delete(scanner);
-   scanner = new LILC::LilC_Scanner( &in_stream );
-   delete(parser); 
-   delete(astRoot);
-   try
+   else if( ! parsed )
    {
-      parser = new LILC::LilC_Parser( (*scanner) /* scanner */, 
-                                  (*this) /* compiler */ );
+      delete(parser); 
+      try
+      {
+         parser = new LILC::LilC_Parser( (*scanner) /* scanner */, 
+                                     astRoot /* where the tree goes */,
+                                     nodes /* AST arena */,
+                                     exps /* shared expressions */ );
+      }
+      catch( std::bad_alloc &ba )
+      {
+         std::cerr << "Failed to allocate parser: (" << 
+            ba.what() << "), exiting!!\n";
+         exit( EXIT_FAILURE );
+      }
+      const int accept( 0 );
+      parsed = parser->parse() == accept;
    }
-   catch( std::bad_alloc &ba )
+   if( ! parsed )
    {
-      std::cerr << "Failed to allocate parser: (" << 
-         ba.what() << "), exiting!!\n";
-      exit( EXIT_FAILURE );
+      std::cerr << "Parse failed!!\n";
    }
+   return parsed;
+}
+
+// Parse from's tokens into root with the chosen parser, a fresh one
+bool LILC::LilC_Compiler::parseWith( LilC_Scanner & from, ProgramNode * & root,
+Arena & arena, ExpTable & table ) const
+{
    const int accept( 0 );
-   if( parser->parse() != accept )
-   {
-      std::cerr << "Parse failed!!\n";
+   if( parserBackend == ParserBackend::DESCENT ) {
+      DescentParser descent( from, root, arena, table );
+      return descent.parse() == accept;
+   }
+   LilC_Parser generated( from, root, arena, table );
+   return generated.parse() == accept;
+}
+
+// Write program's unparse to outfile; in parallel, the parts are
+// written as they are, without joining them first
+template <typename Program>
+void LILC::LilC_Compiler::unparseTo( Program & program, const char * outfile )
+{
+   if( unparseThreads > 1 ) {
+      std::vector<OutputBuffer> parts;
+      program.unparse( threadPool( unparseThreads ), parts );
+      if( ! OutputBuffer::writeAll( outfile, parts ) ) {
+         exit( EXIT_FAILURE );
+      }
+      return;
+   }
+   std::ofstream out(outfile);
+   program.unparse( out );
+}
+
+void 
+LILC::LilC_Compiler::parse( const char * const filename, const char * const outfile )
+{
+   assert( filename != nullptr );
+   openSource( filename );
+
+   // An image of this very source means there is nothing to parse
+   uint64_t sourceHash = 0;
+   std::string cached;
+   if( ! cacheDir.empty() ) {
+      sourceHash = ASTImage::contentHash( sourceText(), sourceSize() );
+      cached = imagePath( sourceHash );
+      if( image.open( cached.c_str(), sourceHash, sourceSize() ) ) {
+         unparseTo( image, outfile );
+         return;
+      }
+   }
+
+   startScanner( filename );
+
+   bool parsed;
+   if( pipelined ) {
+      parsed = parsePipelined();
+   } else {
+      // Lex everything first; the parser then reads the token buffer
+      tokenizeInput();
+      parsed = parseTokens();
+   }
+   // The errors are reported; there is no tree to go on with
+   if( ! parsed ) {
+      return;
+   }
+   // Images are saved from the flat form, so caching a tree flattens
+   // it first
+   bool saving = ! cacheDir.empty();
+   if( astForm == ASTForm::FLAT || saving ) {
+      // About one node per arena allocation
+      size_t made = nodes.allocationCount();
+      for( const Arena * part : partNodes ) {
+         made += part->allocationCount();
+      }
+      flat.reserve( made );
+      this->astRoot->flatten( flat );
+   }
+   if( saving ) {
+      ASTImage::write( flat, cached.c_str(), sourceHash, sourceSize() );
+   }
+   if( astForm == ASTForm::FLAT ) {
+      astRoot = nullptr;
+      nodes.reset();
+      exps.clear();
+      resetParts();
+      unparseTo( flat, outfile );
+      return;
+   }
+   flat.clear();
+   if( hashes ) {
+      this->astRoot->structuralHash();
    }
-   this->astRoot->unparse(out, 0);
+   unparseTo( *this->astRoot, outfile );
    return;
 }
@@ -2,12 +2,23 @@
 #define __LILC_COMPILER_HPP__ 1
 
 #include <string>
+#include <cstdint>
 #include <cstddef>
 #include <istream>
+#include <fstream>
+#include <vector>
 
 #include "lilc_scanner.hpp"
+#include "source_buffer.hpp"
+#include "token_dump.hpp"
+#include "thread_pool.hpp"
+#include "arena.hpp"
+#include "interner.hpp"
 #include "symbols.hpp"
 #include "ast.hpp"
+#include "flat_ast.hpp"
+#include "exp_table.hpp"
+#include "ast_cache.hpp"
 #include "grammar.hh"
 
 namespace LILC{
@@ -23,10 +34,135 @@ public:
 
    void scan( const char * const filename, const char * outfile);
    void parse( const char * const filename, const char * outfile );
+
+   // Edit the source of the last parse in memory, replacing the removed
+   // bytes at offset with the length bytes at inserted, and bring the
+   // tree (getASTRoot) up to date. Only the top-level declarations on
+   // the lines the edit touches are parsed again; the others are kept,
+   // the very same nodes, so an edit inside one function costs about
+   // what parsing that function does, plus moving the locations of
+   // the nodes after it. When there is no tree to start from (the last
+   // parse failed, was served from a .lilast image or left only the
+   // flat form) or expressions are shared, the whole edited source is
+   // parsed instead. Nothing is unparsed (see unparse); false if the
+   // edited source isn't a program, with the errors reported as parse
+   // reports them. Defined in incremental_parser.cpp.
+   bool reparse( size_t offset, size_t removed, const char * inserted,
+                 size_t length );
+   // Unparse the tree, as brought up to date by reparse, to outfile
+   void unparse( const char * outfile );
+
+   // As reparse, but for the token stream of the last scan: only the
+   // lines the edit touches are lexed again (LilC_Scanner::relex), and
+   // only their diagnostics are reported. writeTokens writes the
+   // stream to outfile as scan does.
+   void rescan( size_t offset, size_t removed, const char * inserted,
+                size_t length );
+   void writeTokens( const char * outfile );
+
+   // Scanner implementation used by later scans and parses
+   void setLexer( LilC_Scanner::Backend b ){ lexer = b; }
+   // Parser implementation used by later parses: the one Bison
+   // generates from lilc.yy, or DescentParser (descent_parser.hpp),
+   // which builds the same tree by hand. Every way of parsing uses it.
+   enum class ParserBackend { BISON, DESCENT };
+   void setParser( ParserBackend p ){ parserBackend = p; }
+   // How scan writes the tokens it finds
+   void setDumpFormat( TokenDump::Format f ){ dumpFormat = f; }
+   // Threads to lex with; more than one lexes the input in chunks
+   void setLexThreads( size_t n ){ lexThreads = n == 0 ? 1 : n; }
+   // Threads to parse with; more than one parses runs of top-level
+   // declarations side by side (see parallel_parser.cpp)
+   void setParseThreads( size_t n ){ parseThreads = n == 0 ? 1 : n; }
+   // Whether parse lexes on a thread of its own while it parses, the
+   // tokens going over in batches (see pipelined_parser.cpp), instead
+   // of lexing all of them first; lexing and parsing threads are then
+   // one each
+   void setPipelined( bool on ){ pipelined = on; }
+   // Threads parse unparses with; more than one unparses runs of
+   // top-level declarations side by side
+   void setUnparseThreads( size_t n ){ unparseThreads = n == 0 ? 1 : n; }
+
+   // What parse unparses from: the parser's tree of nodes, or the
+   // flat arrays built from it, after which the tree is released
+   enum class ASTForm { TREE, FLAT };
+   void setASTForm( ASTForm f ){ astForm = f; }
+   const FlatAST & flatAST() const { return flat; }
+
+   // Whether parse gives the tree's statements, functions and structs
+   // their structural hashes (ASTNode::structuralHash) once it is built
+   void setHashing( bool on ){ hashes = on; }
+   bool hashing() const { return hashes; }
+
+   // Whether parse shares structurally identical expressions (see
+   // ExpTable) instead of building a node for each occurrence
+   void setSharedExps( bool on ){ exps.setSharing( on ); }
+   const ExpTable & expTable() const { return exps; }
+
+   // Directory of .lilast images (ast_cache.hpp), each named by the
+   // hash of the source it was parsed from. When set, parse unparses
+   // from the image of its source, if there is one, without lexing or
+   // parsing, and there is then no tree (getASTRoot is null); if there
+   // is none it parses and saves one. Empty, the default, turns it off.
+   void setCacheDir( const std::string & dir ){ cacheDir = dir; }
+   // The image the last parse was served from, if it was
+   const ASTImage & cachedAST() const { return image; }
+
+   const Arena & tokenArena() const { return tokens; }
+   const Arena & astArena() const { return nodes; }
 private:
+   void openSource( const char * const filename );
+   void readStream( const char * const filename );
+   const char * sourceText() const;
+   size_t sourceSize() const;
+   void startScanner( const char * const filename );
+   void openScanner( const char * const filename );
+   std::string imagePath( uint64_t sourceHash ) const;
+   ThreadPool & threadPool( size_t threads );
+   template <typename Program>
+   void unparseTo( Program & program, const char * outfile );
+   void tokenizeInput();
+   void dumpTokens( bool batched, const char * outfile );
+   bool parseTokens();
+   bool parseWith( LilC_Scanner & from, ProgramNode * & root, Arena & arena,
+                   ExpTable & table ) const;
+   bool parseInParallel( ThreadPool & pool );
+   bool parsePipelined();
+   void editSource( size_t offset, size_t removed, const char * inserted,
+                    size_t length );
+   bool parseEdited();
+   void resetParts();
+
    LILC::LilC_Parser  *parser  = nullptr;
    LILC::LilC_Scanner *scanner = nullptr;
    ProgramNode * astRoot = nullptr;
+   LILC::SourceBuffer source;
+   // Whole input when it can't be mapped
+   std::string streamed;
+   LILC::Arena tokens;
+   // Every AST node of the compilation; released with it in one go
+   LILC::Arena nodes;
+   // Shared expressions, all of them in nodes
+   LILC::ExpTable exps{ nodes };
+   // AST nodes of the chunks parsed in parallel, one arena each; they
+   // live as long as nodes does
+   std::vector<LILC::Arena *> partNodes;
+   LILC::FlatAST flat;
+   std::string cacheDir;
+   LILC::ASTImage image;
+   // Not reset between compilations so atoms stay comparable across them
+   LILC::Interner names;
+   LilC_Scanner::Backend lexer = LilC_Scanner::Backend::FLEX;
+   ParserBackend parserBackend = ParserBackend::BISON;
+   size_t lexThreads = 1;
+   size_t parseThreads = 1;
+   bool pipelined = false;
+   size_t unparseThreads = 1;
+   ASTForm astForm = ASTForm::TREE;
+   bool hashes = true;
+   TokenDump::Format dumpFormat = TokenDump::Format::TEXT;
+   // Created on first use, and again when a pass wants another size
+   LILC::ThreadPool *pool = nullptr;
 };
 
 } /* end namespace */
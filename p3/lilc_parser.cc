@@ -0,0 +1,2155 @@
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton implementation for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
+
+
+
+#include "grammar.hh"
+
+
+// Unqualified %code blocks.
+#line 38 "lilc.yy"
+
+   #include <iostream>
+   #include <cstdlib>
+   #include <fstream>
+
+   /* include for interoperation between scanner/parser */
+   #include "lilc_compiler.hpp"
+
+/* tokens come from the stream LilC_Scanner::tokenize recorded */
+#undef yylex
+#define yylex scanner.bufferedLex
+
+/* a location is just where the first symbol of the rule starts; an
+   empty rule gets the start of the symbol before it */
+#define YYLLOC_DEFAULT(Current, Rhs, N) \
+   (Current) = (N) ? YYRHSLOC(Rhs, 1) : YYRHSLOC(Rhs, 0)
+
+#line 64 "lilc_parser.cc"
+
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
+#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(msgid) msgid
+# endif
+#endif
+
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
+# endif
+
+
+// Enable debugging if requested.
+#if YYDEBUG
+
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
+
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
+
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
+
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
+
+#else // !YYDEBUG
+
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
+
+#endif // !YYDEBUG
+
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
+
+#line 5 "lilc.yy"
+namespace LILC {
+#line 157 "lilc_parser.cc"
+
+  /// Build a parser object.
+  LilC_Parser::LilC_Parser (LilC_Scanner  &scanner_yyarg, ProgramNode * &root_yyarg, Arena         &nodes_yyarg, ExpTable      &exps_yyarg)
+#if YYDEBUG
+    : yydebug_ (false),
+      yycdebug_ (&std::cerr),
+#else
+    :
+#endif
+      scanner (scanner_yyarg),
+      root (root_yyarg),
+      nodes (nodes_yyarg),
+      exps (exps_yyarg)
+  {}
+
+  LilC_Parser::~LilC_Parser ()
+  {}
+
+  LilC_Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+  // basic_symbol.
+  template <typename Base>
+  LilC_Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
+  {
+    switch (this->kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.copy< LILC::AssignNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.copy< LILC::DeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.copy< LILC::ExpNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.copy< LILC::FnBodyNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.copy< LILC::FnDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.copy< LILC::FormalDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.copy< LILC::IDToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_id: // id
+        value.copy< LILC::IdNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.copy< LILC::IntLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.copy< LILC::NodeList<LILC::DeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.copy< LILC::NodeList<LILC::ExpNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.copy< LILC::NodeList<LILC::FormalDeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.copy< LILC::NodeList<LILC::StmtNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_program: // program
+        value.copy< LILC::ProgramNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.copy< LILC::StmtNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.copy< LILC::StringLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.copy< LILC::StructDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type: // type
+        value.copy< LILC::TypeNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.copy< LILC::VarDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+  }
+
+
+
+
+  template <typename Base>
+  LilC_Parser::symbol_kind_type
+  LilC_Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+  template <typename Base>
+  bool
+  LilC_Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
+  {
+    return this->kind () == symbol_kind::S_YYEMPTY;
+  }
+
+  template <typename Base>
+  void
+  LilC_Parser::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.move< LILC::AssignNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.move< LILC::DeclNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.move< LILC::ExpNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.move< LILC::FnBodyNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.move< LILC::FnDeclNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.move< LILC::FormalDeclNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.move< LILC::IDToken * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_id: // id
+        value.move< LILC::IdNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.move< LILC::IntLitToken * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.move< LILC::NodeList<LILC::DeclNode *> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.move< LILC::NodeList<LILC::ExpNode *> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.move< LILC::NodeList<LILC::FormalDeclNode *> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.move< LILC::NodeList<LILC::StmtNode *> > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_program: // program
+        value.move< LILC::ProgramNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.move< LILC::StmtNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.move< LILC::StringLitToken * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.move< LILC::StructDeclNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_type: // type
+        value.move< LILC::TypeNode * > (YY_MOVE (s.value));
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.move< LILC::VarDeclNode * > (YY_MOVE (s.value));
+        break;
+
+      default:
+        break;
+    }
+
+    location = YY_MOVE (s.location);
+  }
+
+  // by_kind.
+  LilC_Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
+
+#if 201103L <= YY_CPLUSPLUS
+  LilC_Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {
+    that.clear ();
+  }
+#endif
+
+  LilC_Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
+
+  LilC_Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
+
+
+  void
+  LilC_Parser::by_kind::clear () YY_NOEXCEPT
+  {
+    kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+  void
+  LilC_Parser::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
+
+  LilC_Parser::symbol_kind_type
+  LilC_Parser::by_kind::kind () const YY_NOEXCEPT
+  {
+    return kind_;
+  }
+
+
+  LilC_Parser::symbol_kind_type
+  LilC_Parser::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+
+  // by_state.
+  LilC_Parser::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
+
+  LilC_Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
+
+  void
+  LilC_Parser::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
+
+  void
+  LilC_Parser::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
+
+  LilC_Parser::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
+
+  LilC_Parser::symbol_kind_type
+  LilC_Parser::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
+
+  LilC_Parser::stack_symbol_type::stack_symbol_type ()
+  {}
+
+  LilC_Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.YY_MOVE_OR_COPY< LILC::AssignNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.YY_MOVE_OR_COPY< LILC::DeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.YY_MOVE_OR_COPY< LILC::ExpNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.YY_MOVE_OR_COPY< LILC::FnBodyNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.YY_MOVE_OR_COPY< LILC::FnDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.YY_MOVE_OR_COPY< LILC::FormalDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.YY_MOVE_OR_COPY< LILC::IDToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_id: // id
+        value.YY_MOVE_OR_COPY< LILC::IdNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.YY_MOVE_OR_COPY< LILC::IntLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.YY_MOVE_OR_COPY< LILC::NodeList<LILC::DeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.YY_MOVE_OR_COPY< LILC::NodeList<LILC::ExpNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.YY_MOVE_OR_COPY< LILC::NodeList<LILC::FormalDeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.YY_MOVE_OR_COPY< LILC::NodeList<LILC::StmtNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_program: // program
+        value.YY_MOVE_OR_COPY< LILC::ProgramNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.YY_MOVE_OR_COPY< LILC::StmtNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.YY_MOVE_OR_COPY< LILC::StringLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.YY_MOVE_OR_COPY< LILC::StructDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type: // type
+        value.YY_MOVE_OR_COPY< LILC::TypeNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.YY_MOVE_OR_COPY< LILC::VarDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  LilC_Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.move< LILC::AssignNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.move< LILC::DeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.move< LILC::ExpNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.move< LILC::FnBodyNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.move< LILC::FnDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.move< LILC::FormalDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.move< LILC::IDToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_id: // id
+        value.move< LILC::IdNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.move< LILC::IntLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.move< LILC::NodeList<LILC::DeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.move< LILC::NodeList<LILC::ExpNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.move< LILC::NodeList<LILC::FormalDeclNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.move< LILC::NodeList<LILC::StmtNode *> > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_program: // program
+        value.move< LILC::ProgramNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.move< LILC::StmtNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.move< LILC::StringLitToken * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.move< LILC::StructDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_type: // type
+        value.move< LILC::TypeNode * > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.move< LILC::VarDeclNode * > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  LilC_Parser::stack_symbol_type&
+  LilC_Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.copy< LILC::AssignNode * > (that.value);
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.copy< LILC::DeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.copy< LILC::ExpNode * > (that.value);
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.copy< LILC::FnBodyNode * > (that.value);
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.copy< LILC::FnDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.copy< LILC::FormalDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.copy< LILC::IDToken * > (that.value);
+        break;
+
+      case symbol_kind::S_id: // id
+        value.copy< LILC::IdNode * > (that.value);
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.copy< LILC::IntLitToken * > (that.value);
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.copy< LILC::NodeList<LILC::DeclNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.copy< LILC::NodeList<LILC::ExpNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.copy< LILC::NodeList<LILC::FormalDeclNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.copy< LILC::NodeList<LILC::StmtNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_program: // program
+        value.copy< LILC::ProgramNode * > (that.value);
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.copy< LILC::StmtNode * > (that.value);
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.copy< LILC::StringLitToken * > (that.value);
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.copy< LILC::StructDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_type: // type
+        value.copy< LILC::TypeNode * > (that.value);
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.copy< LILC::VarDeclNode * > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
+  LilC_Parser::stack_symbol_type&
+  LilC_Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        value.move< LILC::AssignNode * > (that.value);
+        break;
+
+      case symbol_kind::S_decl: // decl
+        value.move< LILC::DeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        value.move< LILC::ExpNode * > (that.value);
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        value.move< LILC::FnBodyNode * > (that.value);
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        value.move< LILC::FnDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        value.move< LILC::FormalDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_ID: // ID
+        value.move< LILC::IDToken * > (that.value);
+        break;
+
+      case symbol_kind::S_id: // id
+        value.move< LILC::IdNode * > (that.value);
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        value.move< LILC::IntLitToken * > (that.value);
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        value.move< LILC::NodeList<LILC::DeclNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        value.move< LILC::NodeList<LILC::ExpNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        value.move< LILC::NodeList<LILC::FormalDeclNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        value.move< LILC::NodeList<LILC::StmtNode *> > (that.value);
+        break;
+
+      case symbol_kind::S_program: // program
+        value.move< LILC::ProgramNode * > (that.value);
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        value.move< LILC::StmtNode * > (that.value);
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        value.move< LILC::StringLitToken * > (that.value);
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        value.move< LILC::StructDeclNode * > (that.value);
+        break;
+
+      case symbol_kind::S_type: // type
+        value.move< LILC::TypeNode * > (that.value);
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        value.move< LILC::VarDeclNode * > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
+
+  template <typename Base>
+  void
+  LilC_Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+  }
+
+#if YYDEBUG
+  template <typename Base>
+  void
+  LilC_Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
+      }
+  }
+#endif
+
+  void
+  LilC_Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
+
+  void
+  LilC_Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
+
+  void
+  LilC_Parser::yypop_ (int n) YY_NOEXCEPT
+  {
+    yystack_.pop (n);
+  }
+
+#if YYDEBUG
+  std::ostream&
+  LilC_Parser::debug_stream () const
+  {
+    return *yycdebug_;
+  }
+
+  void
+  LilC_Parser::set_debug_stream (std::ostream& o)
+  {
+    yycdebug_ = &o;
+  }
+
+
+  LilC_Parser::debug_level_type
+  LilC_Parser::debug_level () const
+  {
+    return yydebug_;
+  }
+
+  void
+  LilC_Parser::set_debug_level (debug_level_type l)
+  {
+    yydebug_ = l;
+  }
+#endif // YYDEBUG
+
+  LilC_Parser::state_type
+  LilC_Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
+  {
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
+    else
+      return yydefgoto_[yysym - YYNTOKENS];
+  }
+
+  bool
+  LilC_Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yypact_ninf_;
+  }
+
+  bool
+  LilC_Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
+
+  int
+  LilC_Parser::operator() ()
+  {
+    return parse ();
+  }
+
+  int
+  LilC_Parser::parse ()
+  {
+    int yyn;
+    /// Length of the RHS of the rule being reduced.
+    int yylen = 0;
+
+    // Error handling.
+    int yynerrs_ = 0;
+    int yyerrstatus_ = 0;
+
+    /// The lookahead symbol.
+    symbol_type yyla;
+
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
+
+    /// The return value of parse ().
+    int yyresult;
+
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
+
+
+    /* Initialize the stack.  The initial state will be set in
+       yynewstate, since the latter expects the semantical and the
+       location values to have been already stored, initialize these
+       stacks with a primary value.  */
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
+
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
+  yynewstate:
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
+
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
+
+    goto yybackup;
+
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
+      goto yydefault;
+
+    // Read a lookahead token.
+    if (yyla.empty ())
+      {
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            yyla.kind_ = yytranslate_ (yylex (&yyla.value, &yyla.location));
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
+      }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
+
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
+
+    // Reduce or error.
+    yyn = yytable_[yyn];
+    if (yyn <= 0)
+      {
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        yyn = -yyn;
+        goto yyreduce;
+      }
+
+    // Count tokens shifted since error; after three, turn off error status.
+    if (yyerrstatus_)
+      --yyerrstatus_;
+
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
+    goto yynewstate;
+
+
+  /*-----------------------------------------------------------.
+  | yydefault -- do the default action for the current state.  |
+  `-----------------------------------------------------------*/
+  yydefault:
+    yyn = yydefact_[+yystack_[0].state];
+    if (yyn == 0)
+      goto yyerrlab;
+    goto yyreduce;
+
+
+  /*-----------------------------.
+  | yyreduce -- do a reduction.  |
+  `-----------------------------*/
+  yyreduce:
+    yylen = yyr2_[yyn];
+    {
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* Variants are always initialized to an empty instance of the
+         correct type. The default '$$ = $1' action is NOT applied
+         when using variants.  */
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_assignExp: // assignExp
+        yylhs.value.emplace< LILC::AssignNode * > ();
+        break;
+
+      case symbol_kind::S_decl: // decl
+        yylhs.value.emplace< LILC::DeclNode * > ();
+        break;
+
+      case symbol_kind::S_exp: // exp
+      case symbol_kind::S_term: // term
+      case symbol_kind::S_fncall: // fncall
+      case symbol_kind::S_loc: // loc
+        yylhs.value.emplace< LILC::ExpNode * > ();
+        break;
+
+      case symbol_kind::S_fnBody: // fnBody
+        yylhs.value.emplace< LILC::FnBodyNode * > ();
+        break;
+
+      case symbol_kind::S_fnDecl: // fnDecl
+        yylhs.value.emplace< LILC::FnDeclNode * > ();
+        break;
+
+      case symbol_kind::S_formalDecl: // formalDecl
+        yylhs.value.emplace< LILC::FormalDeclNode * > ();
+        break;
+
+      case symbol_kind::S_ID: // ID
+        yylhs.value.emplace< LILC::IDToken * > ();
+        break;
+
+      case symbol_kind::S_id: // id
+        yylhs.value.emplace< LILC::IdNode * > ();
+        break;
+
+      case symbol_kind::S_INTLITERAL: // INTLITERAL
+        yylhs.value.emplace< LILC::IntLitToken * > ();
+        break;
+
+      case symbol_kind::S_declList: // declList
+      case symbol_kind::S_varDeclList: // varDeclList
+      case symbol_kind::S_structBody: // structBody
+        yylhs.value.emplace< LILC::NodeList<LILC::DeclNode *> > ();
+        break;
+
+      case symbol_kind::S_actualList: // actualList
+        yylhs.value.emplace< LILC::NodeList<LILC::ExpNode *> > ();
+        break;
+
+      case symbol_kind::S_formals: // formals
+      case symbol_kind::S_formalsList: // formalsList
+        yylhs.value.emplace< LILC::NodeList<LILC::FormalDeclNode *> > ();
+        break;
+
+      case symbol_kind::S_stmtList: // stmtList
+        yylhs.value.emplace< LILC::NodeList<LILC::StmtNode *> > ();
+        break;
+
+      case symbol_kind::S_program: // program
+        yylhs.value.emplace< LILC::ProgramNode * > ();
+        break;
+
+      case symbol_kind::S_stmt: // stmt
+        yylhs.value.emplace< LILC::StmtNode * > ();
+        break;
+
+      case symbol_kind::S_STRINGLITERAL: // STRINGLITERAL
+        yylhs.value.emplace< LILC::StringLitToken * > ();
+        break;
+
+      case symbol_kind::S_structDecl: // structDecl
+        yylhs.value.emplace< LILC::StructDeclNode * > ();
+        break;
+
+      case symbol_kind::S_type: // type
+        yylhs.value.emplace< LILC::TypeNode * > ();
+        break;
+
+      case symbol_kind::S_varDecl: // varDecl
+        yylhs.value.emplace< LILC::VarDeclNode * > ();
+        break;
+
+      default:
+        break;
+    }
+
+
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
+
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // program: declList
+#line 150 "lilc.yy"
+                   {
+		   //$$ = nodes.make<ProgramNode>(@$, nodes.make<DeclListNode>(@1, std::move($1)));
+		   yylhs.value.as < LILC::ProgramNode * > () = nodes.make<ProgramNode>(yylhs.location, nodes.make<DeclListNode>(yystack_[0].location, std::move(yystack_[0].value.as < LILC::NodeList<LILC::DeclNode *> > ())));
+		   root = yylhs.value.as < LILC::ProgramNode * > ();
+		   }
+#line 1227 "lilc_parser.cc"
+    break;
+
+  case 3: // declList: declList decl
+#line 157 "lilc.yy"
+                         {
+			 yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = std::move(yystack_[1].value.as < LILC::NodeList<LILC::DeclNode *> > ());
+			 yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > ().push_back(yystack_[0].value.as < LILC::DeclNode * > ());
+			 }
+#line 1236 "lilc_parser.cc"
+    break;
+
+  case 4: // declList: %empty
+#line 161 "lilc.yy"
+                        {
+			yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = NodeList<DeclNode *>(nodes);
+			}
+#line 1244 "lilc_parser.cc"
+    break;
+
+  case 5: // decl: varDecl
+#line 166 "lilc.yy"
+               { yylhs.value.as < LILC::DeclNode * > () = yystack_[0].value.as < LILC::VarDeclNode * > (); }
+#line 1250 "lilc_parser.cc"
+    break;
+
+  case 6: // decl: fnDecl
+#line 167 "lilc.yy"
+                   { yylhs.value.as < LILC::DeclNode * > () = yystack_[0].value.as < LILC::FnDeclNode * > (); }
+#line 1256 "lilc_parser.cc"
+    break;
+
+  case 7: // decl: structDecl
+#line 168 "lilc.yy"
+                       { yylhs.value.as < LILC::DeclNode * > () = yystack_[0].value.as < LILC::StructDeclNode * > (); }
+#line 1262 "lilc_parser.cc"
+    break;
+
+  case 8: // varDeclList: varDeclList varDecl
+#line 171 "lilc.yy"
+                                  {
+				yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = std::move(yystack_[1].value.as < LILC::NodeList<LILC::DeclNode *> > ());
+				yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > ().push_back(yystack_[0].value.as < LILC::VarDeclNode * > ());
+				}
+#line 1271 "lilc_parser.cc"
+    break;
+
+  case 9: // varDeclList: %empty
+#line 175 "lilc.yy"
+                        { yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = NodeList<DeclNode *>(nodes); }
+#line 1277 "lilc_parser.cc"
+    break;
+
+  case 10: // varDecl: type id SEMICOLON
+#line 178 "lilc.yy"
+                            {
+		yylhs.value.as < LILC::VarDeclNode * > () = nodes.make<VarDeclNode>(yylhs.location, yystack_[2].value.as < LILC::TypeNode * > (), yystack_[1].value.as < LILC::IdNode * > (), VarDeclNode::NOT_STRUCT);
+			    }
+#line 1285 "lilc_parser.cc"
+    break;
+
+  case 11: // varDecl: STRUCT id id SEMICOLON
+#line 181 "lilc.yy"
+                                   { yylhs.value.as < LILC::VarDeclNode * > () = nodes.make<VarDeclNode>(yylhs.location, nodes.make<StructNode>(yystack_[2].location, yystack_[2].value.as < LILC::IdNode * > ()), yystack_[1].value.as < LILC::IdNode * > (), 1); }
+#line 1291 "lilc_parser.cc"
+    break;
+
+  case 12: // fnDecl: type id formals fnBody
+#line 184 "lilc.yy"
+                                { yylhs.value.as < LILC::FnDeclNode * > () = nodes.make<FnDeclNode>(yylhs.location, yystack_[3].value.as < LILC::TypeNode * > (), yystack_[2].value.as < LILC::IdNode * > (), nodes.make<FormalsListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::FormalDeclNode *> > ())), yystack_[0].value.as < LILC::FnBodyNode * > ()); }
+#line 1297 "lilc_parser.cc"
+    break;
+
+  case 13: // formals: LPAREN RPAREN
+#line 185 "lilc.yy"
+                        { yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > () = NodeList<FormalDeclNode *>(nodes); }
+#line 1303 "lilc_parser.cc"
+    break;
+
+  case 14: // formals: LPAREN formalsList RPAREN
+#line 186 "lilc.yy"
+                                      { yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > () = std::move(yystack_[1].value.as < LILC::NodeList<LILC::FormalDeclNode *> > ()); }
+#line 1309 "lilc_parser.cc"
+    break;
+
+  case 15: // formalsList: formalDecl
+#line 189 "lilc.yy"
+                         {
+              yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > () = NodeList<FormalDeclNode *>(nodes);
+              yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > ().push_back(yystack_[0].value.as < LILC::FormalDeclNode * > ());
+          }
+#line 1318 "lilc_parser.cc"
+    break;
+
+  case 16: // formalsList: formalDecl COMMA formalsList
+#line 193 "lilc.yy"
+                                         {
+              yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > () = std::move(yystack_[0].value.as < LILC::NodeList<LILC::FormalDeclNode *> > ());
+              yylhs.value.as < LILC::NodeList<LILC::FormalDeclNode *> > ().push_back(yystack_[2].value.as < LILC::FormalDeclNode * > ());
+          }
+#line 1327 "lilc_parser.cc"
+    break;
+
+  case 17: // formalDecl: type id
+#line 199 "lilc.yy"
+                     { yylhs.value.as < LILC::FormalDeclNode * > () = nodes.make<FormalDeclNode>(yylhs.location, yystack_[1].value.as < LILC::TypeNode * > (), yystack_[0].value.as < LILC::IdNode * > ()); }
+#line 1333 "lilc_parser.cc"
+    break;
+
+  case 18: // structDecl: STRUCT id LCURLY structBody RCURLY SEMICOLON
+#line 201 "lilc.yy"
+                                                          {
+    yylhs.value.as < LILC::StructDeclNode * > () = nodes.make<StructDeclNode>(yylhs.location, nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), yystack_[4].value.as < LILC::IdNode * > ());
+          }
+#line 1341 "lilc_parser.cc"
+    break;
+
+  case 19: // structBody: structBody varDecl
+#line 206 "lilc.yy"
+                                {
+    yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = std::move(yystack_[1].value.as < LILC::NodeList<LILC::DeclNode *> > ());
+    yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > ().push_back(yystack_[0].value.as < LILC::VarDeclNode * > ());
+ }
+#line 1350 "lilc_parser.cc"
+    break;
+
+  case 20: // structBody: varDecl
+#line 210 "lilc.yy"
+                          {
+    yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > () = NodeList<DeclNode *>(nodes);
+    yylhs.value.as < LILC::NodeList<LILC::DeclNode *> > ().push_back(yystack_[0].value.as < LILC::VarDeclNode * > ());
+                }
+#line 1359 "lilc_parser.cc"
+    break;
+
+  case 21: // fnBody: LCURLY varDeclList stmtList RCURLY
+#line 216 "lilc.yy"
+                                            { yylhs.value.as < LILC::FnBodyNode * > () = nodes.make<FnBodyNode>(yylhs.location, nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ()))); }
+#line 1365 "lilc_parser.cc"
+    break;
+
+  case 22: // stmtList: stmtList stmt
+#line 217 "lilc.yy"
+                         {
+    yylhs.value.as < LILC::NodeList<LILC::StmtNode *> > () = std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ());
+    yylhs.value.as < LILC::NodeList<LILC::StmtNode *> > ().push_back(yystack_[0].value.as < LILC::StmtNode * > ());
+}
+#line 1374 "lilc_parser.cc"
+    break;
+
+  case 23: // stmtList: %empty
+#line 221 "lilc.yy"
+                  { yylhs.value.as < LILC::NodeList<LILC::StmtNode *> > () = NodeList<StmtNode *>(nodes); }
+#line 1380 "lilc_parser.cc"
+    break;
+
+  case 24: // stmt: assignExp SEMICOLON
+#line 224 "lilc.yy"
+                           {yylhs.value.as < LILC::StmtNode * > () = nodes.make<AssignStmtNode>(yylhs.location, yystack_[1].value.as < LILC::AssignNode * > ());}
+#line 1386 "lilc_parser.cc"
+    break;
+
+  case 25: // stmt: loc PLUSPLUS SEMICOLON
+#line 225 "lilc.yy"
+                           { yylhs.value.as < LILC::StmtNode * > () = nodes.make<PostIncStmtNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > ()); }
+#line 1392 "lilc_parser.cc"
+    break;
+
+  case 26: // stmt: loc MINUSMINUS SEMICOLON
+#line 226 "lilc.yy"
+                             { yylhs.value.as < LILC::StmtNode * > () = nodes.make<PostDecStmtNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > ()); }
+#line 1398 "lilc_parser.cc"
+    break;
+
+  case 27: // stmt: INPUT READ loc SEMICOLON
+#line 227 "lilc.yy"
+                             { yylhs.value.as < LILC::StmtNode * > () = nodes.make<ReadStmtNode>(yylhs.location, yystack_[1].value.as < LILC::ExpNode * > ()); }
+#line 1404 "lilc_parser.cc"
+    break;
+
+  case 28: // stmt: OUTPUT WRITE exp SEMICOLON
+#line 228 "lilc.yy"
+                                     { yylhs.value.as < LILC::StmtNode * > () = nodes.make<WriteStmtNode>(yylhs.location, yystack_[1].value.as < LILC::ExpNode * > ()); }
+#line 1410 "lilc_parser.cc"
+    break;
+
+  case 29: // stmt: IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY
+#line 229 "lilc.yy"
+                                                            { yylhs.value.as < LILC::StmtNode * > () = nodes.make<IfStmtNode>(yylhs.location, yystack_[5].value.as < LILC::ExpNode * > (), nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ()))); }
+#line 1416 "lilc_parser.cc"
+    break;
+
+  case 30: // stmt: IF LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY ELSE LCURLY varDeclList stmtList RCURLY
+#line 230 "lilc.yy"
+                                                                                                    { yylhs.value.as < LILC::StmtNode * > () = nodes.make<IfElseStmtNode>(yylhs.location, yystack_[10].value.as < LILC::ExpNode * > (), nodes.make<DeclListNode>(yystack_[7].location, std::move(yystack_[7].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[6].location, std::move(yystack_[6].value.as < LILC::NodeList<LILC::StmtNode *> > ())), nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ()))); }
+#line 1422 "lilc_parser.cc"
+    break;
+
+  case 31: // stmt: WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY
+#line 231 "lilc.yy"
+                                                               { yylhs.value.as < LILC::StmtNode * > () = nodes.make<WhileStmtNode>(yylhs.location, yystack_[5].value.as < LILC::ExpNode * > (), nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ()))); }
+#line 1428 "lilc_parser.cc"
+    break;
+
+  case 32: // stmt: WHILE LPAREN exp RPAREN LCURLY varDeclList stmtList RCURLY
+#line 232 "lilc.yy"
+                                                               { yylhs.value.as < LILC::StmtNode * > () = nodes.make<WhileStmtNode>(yylhs.location, yystack_[5].value.as < LILC::ExpNode * > (), nodes.make<DeclListNode>(yystack_[2].location, std::move(yystack_[2].value.as < LILC::NodeList<LILC::DeclNode *> > ())), nodes.make<StmtListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::StmtNode *> > ())));}
+#line 1434 "lilc_parser.cc"
+    break;
+
+  case 33: // stmt: RETURN exp SEMICOLON
+#line 233 "lilc.yy"
+                               { yylhs.value.as < LILC::StmtNode * > () = nodes.make<ReturnStmtNode>(yylhs.location, yystack_[1].value.as < LILC::ExpNode * > ()); }
+#line 1440 "lilc_parser.cc"
+    break;
+
+  case 34: // stmt: RETURN SEMICOLON
+#line 234 "lilc.yy"
+                           { yylhs.value.as < LILC::StmtNode * > () = nodes.make<ReturnStmtNode>(yylhs.location, nullptr);}
+#line 1446 "lilc_parser.cc"
+    break;
+
+  case 35: // stmt: fncall SEMICOLON
+#line 235 "lilc.yy"
+                           { yylhs.value.as < LILC::StmtNode * > () = nodes.make<CallStmtNode>(yylhs.location, yystack_[1].value.as < LILC::ExpNode * > ()); }
+#line 1452 "lilc_parser.cc"
+    break;
+
+  case 36: // assignExp: loc ASSIGN exp
+#line 237 "lilc.yy"
+                           { yylhs.value.as < LILC::AssignNode * > () = nodes.make<AssignNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ());}
+#line 1458 "lilc_parser.cc"
+    break;
+
+  case 37: // exp: assignExp
+#line 239 "lilc.yy"
+                { yylhs.value.as < LILC::ExpNode * > () = yystack_[0].value.as < LILC::AssignNode * > (); }
+#line 1464 "lilc_parser.cc"
+    break;
+
+  case 38: // exp: exp PLUS exp
+#line 240 "lilc.yy"
+                 { yylhs.value.as < LILC::ExpNode * > () = exps.make<PlusNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1470 "lilc_parser.cc"
+    break;
+
+  case 39: // exp: exp MINUS exp
+#line 241 "lilc.yy"
+                  { yylhs.value.as < LILC::ExpNode * > () = exps.make<MinusNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1476 "lilc_parser.cc"
+    break;
+
+  case 40: // exp: exp TIMES exp
+#line 242 "lilc.yy"
+                  { yylhs.value.as < LILC::ExpNode * > () = exps.make<TimesNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1482 "lilc_parser.cc"
+    break;
+
+  case 41: // exp: exp DIVIDE exp
+#line 243 "lilc.yy"
+                   { yylhs.value.as < LILC::ExpNode * > () = exps.make<DivideNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1488 "lilc_parser.cc"
+    break;
+
+  case 42: // exp: NOT exp
+#line 244 "lilc.yy"
+                            { yylhs.value.as < LILC::ExpNode * > () = exps.make<NotNode>(yylhs.location, yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1494 "lilc_parser.cc"
+    break;
+
+  case 43: // exp: exp AND exp
+#line 245 "lilc.yy"
+                { yylhs.value.as < LILC::ExpNode * > () = exps.make<AndNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1500 "lilc_parser.cc"
+    break;
+
+  case 44: // exp: exp OR exp
+#line 246 "lilc.yy"
+               { yylhs.value.as < LILC::ExpNode * > () = exps.make<OrNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1506 "lilc_parser.cc"
+    break;
+
+  case 45: // exp: exp EQUALS exp
+#line 247 "lilc.yy"
+                   { yylhs.value.as < LILC::ExpNode * > () = exps.make<EqualsNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1512 "lilc_parser.cc"
+    break;
+
+  case 46: // exp: exp NOTEQUALS exp
+#line 248 "lilc.yy"
+                      { yylhs.value.as < LILC::ExpNode * > () = exps.make<NotEqualsNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1518 "lilc_parser.cc"
+    break;
+
+  case 47: // exp: exp LESS exp
+#line 249 "lilc.yy"
+                 { yylhs.value.as < LILC::ExpNode * > () = exps.make<LessNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1524 "lilc_parser.cc"
+    break;
+
+  case 48: // exp: exp GREATER exp
+#line 250 "lilc.yy"
+                    { yylhs.value.as < LILC::ExpNode * > () = exps.make<GreaterNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1530 "lilc_parser.cc"
+    break;
+
+  case 49: // exp: exp LESSEQ exp
+#line 251 "lilc.yy"
+                   { yylhs.value.as < LILC::ExpNode * > () = exps.make<LessEqNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1536 "lilc_parser.cc"
+    break;
+
+  case 50: // exp: exp GREATEREQ exp
+#line 252 "lilc.yy"
+                      { yylhs.value.as < LILC::ExpNode * > () = exps.make<GreaterEqNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1542 "lilc_parser.cc"
+    break;
+
+  case 51: // exp: MINUS term
+#line 253 "lilc.yy"
+                               { yylhs.value.as < LILC::ExpNode * > () = exps.make<UnaryMinusNode>(yylhs.location, yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1548 "lilc_parser.cc"
+    break;
+
+  case 52: // exp: term
+#line 254 "lilc.yy"
+         { yylhs.value.as < LILC::ExpNode * > () = yystack_[0].value.as < LILC::ExpNode * > (); }
+#line 1554 "lilc_parser.cc"
+    break;
+
+  case 53: // term: loc
+#line 257 "lilc.yy"
+           { yylhs.value.as < LILC::ExpNode * > () = yystack_[0].value.as < LILC::ExpNode * > (); }
+#line 1560 "lilc_parser.cc"
+    break;
+
+  case 54: // term: INTLITERAL
+#line 258 "lilc.yy"
+               { yylhs.value.as < LILC::ExpNode * > () = exps.make<IntLitNode>(yylhs.location, yystack_[0].value.as < LILC::IntLitToken * > ()->value()); }
+#line 1566 "lilc_parser.cc"
+    break;
+
+  case 55: // term: STRINGLITERAL
+#line 259 "lilc.yy"
+                  { yylhs.value.as < LILC::ExpNode * > () = nodes.make<StrLitNode>(yystack_[0].value.as < LILC::StringLitToken * > ()); }
+#line 1572 "lilc_parser.cc"
+    break;
+
+  case 56: // term: TRUE
+#line 260 "lilc.yy"
+         { yylhs.value.as < LILC::ExpNode * > () = nodes.make<TrueNode>(yylhs.location); }
+#line 1578 "lilc_parser.cc"
+    break;
+
+  case 57: // term: FALSE
+#line 261 "lilc.yy"
+          { yylhs.value.as < LILC::ExpNode * > () = nodes.make<FalseNode>(yylhs.location); }
+#line 1584 "lilc_parser.cc"
+    break;
+
+  case 58: // term: LPAREN exp RPAREN
+#line 262 "lilc.yy"
+                      { yylhs.value.as < LILC::ExpNode * > () = yystack_[1].value.as < LILC::ExpNode * > (); }
+#line 1590 "lilc_parser.cc"
+    break;
+
+  case 59: // term: fncall
+#line 263 "lilc.yy"
+           { yylhs.value.as < LILC::ExpNode * > () = yystack_[0].value.as < LILC::ExpNode * > (); }
+#line 1596 "lilc_parser.cc"
+    break;
+
+  case 60: // fncall: id LPAREN RPAREN
+#line 266 "lilc.yy"
+                          { yylhs.value.as < LILC::ExpNode * > () = nodes.make<CallExpNode>(yylhs.location, yystack_[2].value.as < LILC::IdNode * > (), nodes.make<ExpListNode>(yystack_[0].location, NodeList<ExpNode *>(nodes))); }
+#line 1602 "lilc_parser.cc"
+    break;
+
+  case 61: // fncall: id LPAREN actualList RPAREN
+#line 267 "lilc.yy"
+                                { yylhs.value.as < LILC::ExpNode * > () = nodes.make<CallExpNode>(yylhs.location, yystack_[3].value.as < LILC::IdNode * > (), nodes.make<ExpListNode>(yystack_[1].location, std::move(yystack_[1].value.as < LILC::NodeList<LILC::ExpNode *> > ()))); }
+#line 1608 "lilc_parser.cc"
+    break;
+
+  case 62: // actualList: exp
+#line 270 "lilc.yy"
+                 {
+              yylhs.value.as < LILC::NodeList<LILC::ExpNode *> > () = NodeList<ExpNode *>(nodes);
+              yylhs.value.as < LILC::NodeList<LILC::ExpNode *> > ().push_front(yystack_[0].value.as < LILC::ExpNode * > ());
+              }
+#line 1617 "lilc_parser.cc"
+    break;
+
+  case 63: // actualList: actualList COMMA exp
+#line 274 "lilc.yy"
+                         { yylhs.value.as < LILC::NodeList<LILC::ExpNode *> > () = std::move(yystack_[2].value.as < LILC::NodeList<LILC::ExpNode *> > ()); yylhs.value.as < LILC::NodeList<LILC::ExpNode *> > ().push_front(yystack_[0].value.as < LILC::ExpNode * > ()); }
+#line 1623 "lilc_parser.cc"
+    break;
+
+  case 64: // type: INT
+#line 277 "lilc.yy"
+           { yylhs.value.as < LILC::TypeNode * > () = nodes.make<IntNode>(yylhs.location); }
+#line 1629 "lilc_parser.cc"
+    break;
+
+  case 65: // type: BOOL
+#line 278 "lilc.yy"
+         { yylhs.value.as < LILC::TypeNode * > () = nodes.make<BoolNode>(yylhs.location); }
+#line 1635 "lilc_parser.cc"
+    break;
+
+  case 66: // type: VOID
+#line 279 "lilc.yy"
+         { yylhs.value.as < LILC::TypeNode * > () = nodes.make<VoidNode>(yylhs.location); }
+#line 1641 "lilc_parser.cc"
+    break;
+
+  case 67: // loc: id
+#line 282 "lilc.yy"
+         { yylhs.value.as < LILC::ExpNode * > () = yystack_[0].value.as < LILC::IdNode * > (); }
+#line 1647 "lilc_parser.cc"
+    break;
+
+  case 68: // loc: loc DOT id
+#line 283 "lilc.yy"
+               { yylhs.value.as < LILC::ExpNode * > () = exps.make<DotAccessNode>(yylhs.location, yystack_[2].value.as < LILC::ExpNode * > (), yystack_[0].value.as < LILC::IdNode * > ()); }
+#line 1653 "lilc_parser.cc"
+    break;
+
+  case 69: // id: ID
+#line 286 "lilc.yy"
+        { yylhs.value.as < LILC::IdNode * > () = exps.make<IdNode>(yystack_[0].value.as < LILC::IDToken * > ()); }
+#line 1659 "lilc_parser.cc"
+    break;
+
+
+#line 1663 "lilc_parser.cc"
+
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
+
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
+    }
+    goto yynewstate;
+
+
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
+  yyerrlab:
+    // If not already recovering from an error, report this error.
+    if (!yyerrstatus_)
+      {
+        ++yynerrs_;
+        std::string msg = YY_("syntax error");
+        error (yyla.location, YY_MOVE (msg));
+      }
+
+
+    yyerror_range[1].location = yyla.location;
+    if (yyerrstatus_ == 3)
+      {
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
+      }
+
+    // Else will try to reuse lookahead token after shifting the error token.
+    goto yyerrlab1;
+
+
+  /*---------------------------------------------------.
+  | yyerrorlab -- error raised explicitly by YYERROR.  |
+  `---------------------------------------------------*/
+  yyerrorlab:
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
+    if (false)
+      YYERROR;
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYERROR.  */
+    yypop_ (yylen);
+    yylen = 0;
+    YY_STACK_PRINT ();
+    goto yyerrlab1;
+
+
+  /*-------------------------------------------------------------.
+  | yyerrlab1 -- common code for both syntax error and YYERROR.  |
+  `-------------------------------------------------------------*/
+  yyerrlab1:
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
+
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
+
+      // Shift the error token.
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
+    }
+    goto yynewstate;
+
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
+  yyacceptlab:
+    yyresult = 0;
+    goto yyreturn;
+
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
+  yyabortlab:
+    yyresult = 1;
+    goto yyreturn;
+
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
+  yyreturn:
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
+
+    /* Do not reclaim the symbols of the rule whose action triggered
+       this YYABORT or YYACCEPT.  */
+    yypop_ (yylen);
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
+      {
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
+      }
+
+    return yyresult;
+  }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+  LilC_Parser::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+#if YYDEBUG || 1
+  const char *
+  LilC_Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytname_[yysymbol];
+  }
+#endif // #if YYDEBUG || 1
+
+
+
+
+
+
+
+
+
+  const signed char LilC_Parser::yypact_ninf_ = -77;
+
+  const signed char LilC_Parser::yytable_ninf_ = -1;
+
+  const short
+  LilC_Parser::yypact_[] =
+  {
+     -77,    25,   139,   -77,   -77,   -77,   -77,    21,   -77,   -77,
+     -77,   -77,    21,   -77,    -2,   -19,   160,    30,    81,   -77,
+      37,    21,   -77,   100,    21,   -77,   -77,    45,    49,    21,
+     -77,   -77,    21,    57,   -77,    71,   -77,    78,   -77,   160,
+     -77,   -77,   -77,   266,    43,    70,    77,    96,     2,   -77,
+     -77,    95,   103,    33,   112,    21,    47,    47,    47,   -77,
+     -77,   -77,   -77,    47,   -77,   106,    47,   -77,   161,   -77,
+     -77,   -12,   -77,   -77,    21,   123,   124,    47,    94,     5,
+     -77,   181,    99,   120,   141,   -77,   129,   -77,   -77,    47,
+      47,    47,    47,    47,    47,    47,    47,    47,    47,    47,
+      47,   -77,   -77,   -77,   194,   -77,   194,    10,   -77,   -77,
+     130,   148,   -77,    75,    75,   -77,   -77,   220,   207,   233,
+     233,   233,   233,   233,   233,   -77,    47,   -77,   -77,   194,
+     160,   160,   273,   280,   155,   -77,   151,   -77,   160,   287,
+     -77
+  };
+
+  const signed char
+  LilC_Parser::yydefact_[] =
+  {
+       4,     0,     2,     1,    65,    64,    66,     0,     3,     5,
+       6,     7,     0,    69,     0,     0,     0,     0,     0,    10,
+       0,     0,    20,     0,     0,    11,    13,     0,    15,     0,
+       9,    12,     0,     0,    19,     0,    14,     0,    17,    23,
+      18,    16,     8,     0,     0,     0,     0,     0,     0,    21,
+      22,     0,     0,     0,    67,     0,     0,     0,     0,    56,
+      57,    54,    55,     0,    34,     0,     0,    37,     0,    52,
+      59,    53,    24,    35,     0,     0,     0,     0,     0,     0,
+      67,     0,     0,     0,     0,    51,    53,    42,    33,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    68,    25,    26,    36,    60,    62,     0,    27,    28,
+       0,     0,    58,    38,    39,    40,    41,    43,    44,    45,
+      46,    47,    48,    49,    50,    61,     0,     9,     9,    63,
+      23,    23,     0,     0,    29,    31,     0,     9,    23,     0,
+      30
+  };
+
+  const short
+  LilC_Parser::yypgoto_[] =
+  {
+     -77,   -77,   -77,   -77,   -76,     7,   -77,   -77,   149,   -77,
+     -77,   -77,   -77,   -58,   -77,   -41,   -50,   111,   -39,   -77,
+      -1,   -43,    46
+  };
+
+  const signed char
+  LilC_Parser::yydefgoto_[] =
+  {
+       0,     1,     2,     8,    39,    42,    10,    20,    27,    28,
+      11,    23,    31,    43,    50,    67,    68,    69,    70,   107,
+      24,    71,    54
+  };
+
+  const short
+  LilC_Parser::yytable_[] =
+  {
+      53,    12,    51,    18,    52,    19,    81,    82,    83,     9,
+      59,    60,    79,    84,    74,    13,    87,    29,    16,    13,
+      61,    62,    86,    22,    63,     3,    64,   104,   106,   108,
+      34,    74,    77,   125,    65,   126,    29,    66,    13,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   130,   131,    14,    25,    59,    60,    30,    15,    74,
+      17,   138,    75,    76,    13,    61,    62,    32,    36,    63,
+      35,    55,   132,   133,    37,    38,   129,    77,    17,    65,
+     139,    40,    66,     4,     5,     6,     4,     5,     6,    53,
+      53,    51,    51,    52,    52,    19,    53,    56,    51,    57,
+      52,    80,    59,    60,    26,     4,     5,     6,    91,    92,
+      21,    13,    61,    62,    59,    60,    63,   105,    58,    72,
+     101,    33,   110,    13,    61,    62,    65,    73,    63,    66,
+      89,    90,    91,    92,    78,    93,    94,    95,    96,    97,
+      98,    99,   100,   111,     4,     5,     6,   102,   103,     7,
+     127,    89,    90,    91,    92,    74,    93,    94,    95,    96,
+      97,    98,    99,   100,   112,     4,     5,     6,   128,   136,
+      21,   137,    89,    90,    91,    92,    85,    93,    94,    95,
+      96,    97,    98,    99,   100,    88,    41,     0,     0,     0,
+       0,     0,    89,    90,    91,    92,     0,    93,    94,    95,
+      96,    97,    98,    99,   100,   109,     0,     0,     0,     0,
+       0,     0,    89,    90,    91,    92,     0,    93,    94,    95,
+      96,    97,    98,    99,   100,    89,    90,    91,    92,     0,
+      93,    94,    95,    96,    97,    98,    99,   100,    89,    90,
+      91,    92,     0,    93,     0,    95,    96,    97,    98,    99,
+     100,    89,    90,    91,    92,     0,     0,     0,    95,    96,
+      97,    98,    99,   100,    89,    90,    91,    92,     0,     0,
+       0,    -1,    -1,    -1,    -1,    -1,    -1,    44,    45,    46,
+       0,    47,    48,    13,    44,    45,    46,    49,    47,    48,
+      13,    44,    45,    46,   134,    47,    48,    13,    44,    45,
+      46,   135,    47,    48,    13,     0,     0,     0,   140
+  };
+
+  const short
+  LilC_Parser::yycheck_[] =
+  {
+      43,     2,    43,    22,    43,    24,    56,    57,    58,     2,
+       8,     9,    55,    63,    26,    17,    66,    18,    20,    17,
+      18,    19,    65,    16,    22,     0,    24,    77,    78,    24,
+      23,    26,    44,    23,    32,    25,    37,    35,    17,    89,
+      90,    91,    92,    93,    94,    95,    96,    97,    98,    99,
+     100,   127,   128,     7,    24,     8,     9,    20,    12,    26,
+      14,   137,    29,    30,    17,    18,    19,    21,    23,    22,
+      24,    28,   130,   131,    25,    29,   126,    44,    32,    32,
+     138,    24,    35,     5,     6,     7,     5,     6,     7,   132,
+     133,   132,   133,   132,   133,    24,   139,    27,   139,    22,
+     139,    55,     8,     9,    23,     5,     6,     7,    33,    34,
+      10,    17,    18,    19,     8,     9,    22,    23,    22,    24,
+      74,    21,    23,    17,    18,    19,    32,    24,    22,    35,
+      31,    32,    33,    34,    22,    36,    37,    38,    39,    40,
+      41,    42,    43,    23,     5,     6,     7,    24,    24,    10,
+      20,    31,    32,    33,    34,    26,    36,    37,    38,    39,
+      40,    41,    42,    43,    23,     5,     6,     7,    20,    14,
+      10,    20,    31,    32,    33,    34,    65,    36,    37,    38,
+      39,    40,    41,    42,    43,    24,    37,    -1,    -1,    -1,
+      -1,    -1,    31,    32,    33,    34,    -1,    36,    37,    38,
+      39,    40,    41,    42,    43,    24,    -1,    -1,    -1,    -1,
+      -1,    -1,    31,    32,    33,    34,    -1,    36,    37,    38,
+      39,    40,    41,    42,    43,    31,    32,    33,    34,    -1,
+      36,    37,    38,    39,    40,    41,    42,    43,    31,    32,
+      33,    34,    -1,    36,    -1,    38,    39,    40,    41,    42,
+      43,    31,    32,    33,    34,    -1,    -1,    -1,    38,    39,
+      40,    41,    42,    43,    31,    32,    33,    34,    -1,    -1,
+      -1,    38,    39,    40,    41,    42,    43,    11,    12,    13,
+      -1,    15,    16,    17,    11,    12,    13,    21,    15,    16,
+      17,    11,    12,    13,    21,    15,    16,    17,    11,    12,
+      13,    21,    15,    16,    17,    -1,    -1,    -1,    21
+  };
+
+  const signed char
+  LilC_Parser::yystos_[] =
+  {
+       0,    47,    48,     0,     5,     6,     7,    10,    49,    51,
+      52,    56,    66,    17,    68,    68,    20,    68,    22,    24,
+      53,    10,    51,    57,    66,    24,    23,    54,    55,    66,
+      20,    58,    68,    21,    51,    68,    23,    25,    68,    50,
+      24,    54,    51,    59,    11,    12,    13,    15,    16,    21,
+      60,    61,    64,    67,    68,    28,    27,    22,    22,     8,
+       9,    18,    19,    22,    24,    32,    35,    61,    62,    63,
+      64,    67,    24,    24,    26,    29,    30,    44,    22,    67,
+      68,    62,    62,    62,    62,    63,    67,    62,    24,    31,
+      32,    33,    34,    36,    37,    38,    39,    40,    41,    42,
+      43,    68,    24,    24,    62,    23,    62,    65,    24,    24,
+      23,    23,    23,    62,    62,    62,    62,    62,    62,    62,
+      62,    62,    62,    62,    62,    23,    25,    20,    20,    62,
+      50,    50,    59,    59,    21,    21,    14,    20,    50,    59,
+      21
+  };
+
+  const signed char
+  LilC_Parser::yyr1_[] =
+  {
+       0,    46,    47,    48,    48,    49,    49,    49,    50,    50,
+      51,    51,    52,    53,    53,    54,    54,    55,    56,    57,
+      57,    58,    59,    59,    60,    60,    60,    60,    60,    60,
+      60,    60,    60,    60,    60,    60,    61,    62,    62,    62,
+      62,    62,    62,    62,    62,    62,    62,    62,    62,    62,
+      62,    62,    62,    63,    63,    63,    63,    63,    63,    63,
+      64,    64,    65,    65,    66,    66,    66,    67,    67,    68
+  };
+
+  const signed char
+  LilC_Parser::yyr2_[] =
+  {
+       0,     2,     1,     2,     0,     1,     1,     1,     2,     0,
+       3,     4,     4,     2,     3,     1,     3,     2,     6,     2,
+       1,     4,     2,     0,     2,     3,     3,     4,     4,     8,
+      13,     8,     8,     3,     2,     2,     3,     1,     3,     3,
+       3,     3,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     2,     1,     1,     1,     1,     1,     1,     3,     1,
+       3,     4,     1,     3,     1,     1,     1,     1,     3,     1
+  };
+
+
+#if YYDEBUG || 1
+  // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
+  const char*
+  const LilC_Parser::yytname_[] =
+  {
+  "\"end of file\"", "error", "\"invalid token\"", "\"newline\"", "CHAR",
+  "BOOL", "INT", "VOID", "TRUE", "FALSE", "STRUCT", "INPUT", "OUTPUT",
+  "IF", "ELSE", "WHILE", "RETURN", "ID", "INTLITERAL", "STRINGLITERAL",
+  "LCURLY", "RCURLY", "LPAREN", "RPAREN", "SEMICOLON", "COMMA", "DOT",
+  "WRITE", "READ", "PLUSPLUS", "MINUSMINUS", "PLUS", "MINUS", "TIMES",
+  "DIVIDE", "NOT", "AND", "OR", "EQUALS", "NOTEQUALS", "LESS", "GREATER",
+  "LESSEQ", "GREATEREQ", "ASSIGN", "UNARYPREC", "$accept", "program",
+  "declList", "decl", "varDeclList", "varDecl", "fnDecl", "formals",
+  "formalsList", "formalDecl", "structDecl", "structBody", "fnBody",
+  "stmtList", "stmt", "assignExp", "exp", "term", "fncall", "actualList",
+  "type", "loc", "id", YY_NULLPTR
+  };
+#endif
+
+
+#if YYDEBUG
+  const short
+  LilC_Parser::yyrline_[] =
+  {
+       0,   150,   150,   157,   161,   166,   167,   168,   171,   175,
+     178,   181,   184,   185,   186,   189,   193,   199,   201,   206,
+     210,   216,   217,   221,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   237,   239,   240,   241,
+     242,   243,   244,   245,   246,   247,   248,   249,   250,   251,
+     252,   253,   254,   257,   258,   259,   260,   261,   262,   263,
+     266,   267,   270,   274,   277,   278,   279,   282,   283,   286
+  };
+
+  void
+  LilC_Parser::yy_stack_print_ () const
+  {
+    *yycdebug_ << "Stack now";
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
+  }
+
+  void
+  LilC_Parser::yy_reduce_print_ (int yyrule) const
+  {
+    int yylno = yyrline_[yyrule];
+    int yynrhs = yyr2_[yyrule];
+    // Print the symbols being reduced, and their result.
+    *yycdebug_ << "Reducing stack by rule " << yyrule - 1
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
+    for (int yyi = 0; yyi < yynrhs; yyi++)
+      YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
+                       yystack_[(yynrhs) - (yyi + 1)]);
+  }
+#endif // YYDEBUG
+
+  LilC_Parser::symbol_kind_type
+  LilC_Parser::yytranslate_ (int t) YY_NOEXCEPT
+  {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45
+    };
+    // Last valid token kind.
+    const int code_max = 300;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
+  }
+
+#line 5 "lilc.yy"
+} // LILC
+#line 2148 "lilc_parser.cc"
+
+#line 287 "lilc.yy"
+
+void
+LILC::LilC_Parser::error(const location_type &l, const std::string &err_message )
+{
+   scanner.error(l, err_message);
+}
@@ -5,46 +5,240 @@
 #include <FlexLexer.h>
 #endif
 
+#include <cstdint>
+#include <vector>
+
 #include "grammar.hh"
+#include "arena.hpp"
+#include "interner.hpp"
+#include "source_loc.hpp"
+#include "token_buffer.hpp"
+#include "token_ring.hpp"
+#include "thread_pool.hpp"
 
 namespace LILC{
 
 class LilC_Scanner : public yyFlexLexer{
 public:
    
-   LilC_Scanner(std::istream *in) : yyFlexLexer(in)
+   // Every token the scanner produces is allocated from tokens, so
+   // tokens live exactly as long as the arena (one compilation).
+   // Identifier spellings are interned in names, which outlives them.
+   // Input always comes from scanBuffer, which is what lets tokens be
+   // located by byte offset.
+   LilC_Scanner(Arena &arena, Interner &interner)
+   : yyFlexLexer(nullptr), tokens(arena), names(interner)
    {
    };
    virtual ~LilC_Scanner() {
    };
 
+   // Which implementation yylex uses. FLEX is the generated table
+   // scanner from lilc.l; SIMD is the hand-written scanner in
+   // simd_lexer.cpp, which only works on input set up by scanBuffer.
+   // Both produce the same tokens and diagnostics.
+   enum class Backend { FLEX, SIMD };
+   void setBackend(Backend b){ backend = b; }
+   Backend getBackend() const { return backend; }
+
    //get rid of override virtual function warning
    using FlexLexer::yylex;
 
-   // YY_DECL defined in the flex file.l
    virtual
-   int yylex( LILC::LilC_Parser::semantic_type * const lval);
+   int yylex( LILC::LilC_Parser::semantic_type * const lval){
+	if (backend == Backend::SIMD){ return simdLex(lval); }
+	return flexLex(lval);
+   }
 
-   void warn(int lineNum, int charNum, std::string msg){
-	std::cerr << lineNum << ":" << charNum << " ***WARNING*** " << msg << std::endl;
+   // Scan size bytes at base in place, like flex's C-only
+   // yy_scan_buffer. base[size] and base[size+1] must be NUL and the
+   // memory must stay valid (and writable) for the life of the
+   // scanner. Also builds the line table for the buffer.
+   bool scanBuffer(char * base, size_t size){
+	if (!switchToBuffer(base, size)){ return false; }
+	ownLines.build(base, size);
+	lines = &ownLines;
+	locBase = 0;
+	return true;
    }
 
-   void error(int lineNum, int charNum, std::string msg){
-	std::cerr << lineNum << ":" << charNum << " ***ERROR*** " << msg << std::endl;
+   // Lines of the buffer, for turning a SourceLoc into line and column
+   const LineTable & lineTable() const { return *lines; }
+
+   // Tokenize the whole buffer given to scanBuffer into tokenBuffer(),
+   // which then ends with an END token. Diagnostics are reported just
+   // as when scanning token by token, but no token objects are
+   // allocated. Defined in token_buffer.cpp, like bufferedLex.
+   void tokenize();
+   const TokenBuffer & tokenBuffer(){ closeGap(); return batch; }
+   // yylex over the stream recorded by tokenize: hands out the buffered
+   // tokens in order, building a semantic value only for ID and literal
+   // tokens (nothing reads the value of the others), and the token's
+   // location if lloc is given.
+   int bufferedLex( LILC::LilC_Parser::semantic_type * const lval,
+                    SourceLoc * const lloc = nullptr);
+
+   // Empty a semantic value yylex or bufferedLex filled in for a token
+   // with tag, as the parser does once it has shifted the token, so the
+   // value can be passed in again for the next one.
+   static void clearValue(int tag, LILC::LilC_Parser::semantic_type &value);
+
+   // tokenize, but with the buffer cut into chunks at line breaks and
+   // the chunks lexed on pool. The result, including the order of
+   // diagnostics, is exactly what tokenize would have produced.
+   // Defined in parallel_lexer.cpp.
+   void tokenizeParallel(ThreadPool &pool);
+
+   // For parsing a piece of the stream (parallel_parser.cpp and
+   // incremental_parser.cpp). internIdentifiers interns the identifiers
+   // of the stream from tokenize, in order, giving them the atoms
+   // bufferedLex would have. followTokens makes this scanner's
+   // bufferedLex hand out tokens [begin, end) of whole's stream and
+   // then END; given atoms, it takes the atoms of the identifiers among
+   // them from there, in order, and never interns.
+   void internIdentifiers(std::vector<Atom> &atoms);
+   void followTokens(const LilC_Scanner &whole, size_t begin, size_t end,
+                     const Atom * atoms);
+
+   // Lexing and parsing on two threads at once (pipelined_parser.cpp).
+   // tokenizeInto is tokenize, but handing the tokens over to ring in
+   // batches as they are found; if the reader quits, it lexes on for
+   // the diagnostics alone. followRing makes this scanner's
+   // bufferedLex hand out the tokens whole's tokenizeInto puts in ring.
+   void tokenizeInto(TokenRing &ring);
+   void followRing(const LilC_Scanner &whole, TokenRing &ring);
+
+   // Bring the token stream from tokenize up to date with an edit of
+   // the buffer: base now holds size bytes (padded as for scanBuffer),
+   // which are the old contents with the removed bytes at offset
+   // replaced by inserted new ones. Only the lines the edit touches are
+   // lexed again, so the cost follows the size of the edit rather than
+   // of the file. Diagnostics are reported for those lines only.
+   // Defined in incremental_lexer.cpp.
+   void relex(char * base, size_t size, size_t offset, size_t removed,
+              size_t inserted);
+
+   // The stream from tokenize, as relex keeps it, read without closing
+   // its gap: the number of tokens, END included, where token i starts,
+   // and the first token starting at or after byte at
+   size_t tokenCount() const { return batch.size() - gapLength; }
+   uint32_t tokenOffset(size_t i) const {
+	return i < gapBegin ? batch.starts[i] : batch.starts[i + gapLength] + tailShift;
+   }
+   size_t firstTokenAt(size_t at) const;
+
+   // Where warn and error write; std::cerr unless redirected
+   void setDiagnostics(std::ostream &out){ diagnostics = &out; }
+
+   void warn(SourceLoc at, std::string msg){
+	report(at, " ***WARNING*** ", msg);
+   }
+
+   void error(SourceLoc at, std::string msg){
+	report(at, " ***ERROR*** ", msg);
    }
 
+   // The produce functions build the semantic value of the token just
+   // matched, unless yylex was called without one (as tokenize does).
+   // Only ID and the literals have one; the other tokens are untyped
+   // in the grammar and leave the value empty.
    int produceNullaryToken(int tag){
-	this->yylval->symbolValue = new NullaryToken(lineNum, charNum, tag);
-	charNum += yyleng;
 	return tag;
    }
 
+   int produceIDToken(const char * text, size_t length){
+	if (yylval != nullptr){
+		yylval->emplace<IDToken *>(tokens.make<IDToken>(locAt(tokenStart),
+			names.intern(text, length)));
+	}
+	return LILC::LilC_Parser::token::ID;
+   }
+
+   int produceIntLitToken(const char * text, size_t length){
+	if (yylval != nullptr){
+		yylval->emplace<IntLitToken *>(tokens.make<IntLitToken>(
+			locAt(tokenStart), text, static_cast<uint32_t>(length)));
+	}
+	return LILC::LilC_Parser::token::INTLITERAL;
+   }
+
+   int produceStringLitToken(const char * text, size_t length){
+	if (yylval != nullptr){
+		yylval->emplace<StringLitToken *>(tokens.make<StringLitToken>(
+			locAt(tokenStart), text, static_cast<uint32_t>(length)));
+	}
+	return LILC::LilC_Parser::token::STRINGLITERAL;
+   }
+
 
 private:
+   // YY_DECL defined in the flex file.l
+   int flexLex( LILC::LilC_Parser::semantic_type * const lval);
+   // Defined in simd_lexer.cpp
+   int simdLex( LILC::LilC_Parser::semantic_type * const lval);
+   // The flex half of scanBuffer, defined in lilc.l
+   bool switchToBuffer(char * base, size_t size);
+
    /* yyval ptr */
    LILC::LilC_Parser::semantic_type *yylval = nullptr;
-   size_t lineNum;
-   size_t charNum;
+   Arena &tokens;
+   Interner &names;
+
+   void markToken(const char * text, size_t length){
+	tokenStart = text;
+	tokenLength = length;
+   }
+
+   // Location of p, a pointer into the buffer
+   SourceLoc locAt(const char * p) const {
+	return SourceLoc(locBase + static_cast<uint32_t>(p - bufferStart));
+   }
+
+   void report(SourceLoc at, const char * kind, const std::string &msg){
+	LineColumn pos = lines->position(at);
+	*diagnostics << pos.line << ":" << pos.column << kind << msg << std::endl;
+   }
+
+   Backend backend = Backend::FLEX;
+   // The buffer given to scanBuffer and its unscanned part (SIMD backend)
+   const char *bufferStart = nullptr;
+   const char *cursor = nullptr;
+   const char *bufferEnd = nullptr;
+   // Span of the most recent match
+   const char *tokenStart = nullptr;
+   size_t tokenLength = 0;
+   // Lines of the source. A scanner working on a piece of a larger
+   // buffer (see parallel_lexer.cpp) shares the whole buffer's table
+   // and has the offset of its piece in locBase.
+   LineTable ownLines;
+   const LineTable *lines = &ownLines;
+   uint32_t locBase = 0;
+
+   TokenBuffer batch;
+   size_t batchNext = 0;
+   // Atoms of the identifiers still to come, set by followTokens
+   const Atom * atoms = nullptr;
+   // Where batch is refilled from once it runs out, set by followRing
+   TokenRing * ring = nullptr;
+   // relex keeps batch as a gap buffer: entries [gapBegin, gapBegin +
+   // gapLength) are unused, and entries after them have their start
+   // stored minus tailShift, so an edit moves everything after it by
+   // changing just the shift. closeGap turns batch back into a plain
+   // token stream.
+   size_t gapBegin = 0;
+   size_t gapLength = 0;
+   uint32_t tailShift = 0;
+   void closeGap(){
+	if (gapBegin != batch.size()){ flattenTokens(); }
+   }
+   void flattenTokens();
+   void moveGap(size_t index);
+   void resetGap(){
+	gapBegin = batch.size();
+	gapLength = 0;
+	tailShift = 0;
+   }
+   std::ostream *diagnostics = &std::cerr;
 };
 
 } /* end namespace */
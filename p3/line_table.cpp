@@ -0,0 +1,97 @@
+#include <cstring>
+
+#include "source_loc.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+void LILC::LineTable::build(const char * text, size_t size)
+{
+   starts.clear();
+   // Generated code averages a line every 30 bytes or so
+   starts.reserve(size / 32 + 1);
+   starts.push_back(0);
+   size_t i = 0;
+#if defined(__SSE2__)
+   const __m128i newline = _mm_set1_epi8('\n');
+   for (; i + 16 <= size; i += 16){
+      __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(text + i));
+      unsigned mask = static_cast<unsigned>(
+         _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+      while (mask != 0){
+         starts.push_back(static_cast<uint32_t>(i + __builtin_ctz(mask) + 1));
+         mask &= mask - 1;
+      }
+   }
+#endif
+   for (; i < size; i++){
+      if (text[i] == '\n'){
+         starts.push_back(static_cast<uint32_t>(i + 1));
+      }
+   }
+   gapBegin = starts.size();
+   gapLength = 0;
+   shift = 0;
+}
+
+size_t LILC::LineTable::lineAfter(uint32_t offset) const
+{
+   size_t lo = 0, hi = lineCount();
+   while (lo < hi){
+      size_t mid = lo + (hi - lo) / 2;
+      if (startOf(mid) <= offset){ lo = mid + 1; } else { hi = mid; }
+   }
+   return lo;
+}
+
+LILC::LineColumn LILC::LineTable::position(SourceLoc loc) const
+{
+   // Line 1 starts at 0, so there is always a line at or before loc
+   size_t line = lineAfter(loc.offset);
+   LineColumn result;
+   result.line = static_cast<uint32_t>(line);
+   result.column = loc.offset - startOf(line - 1) + 1;
+   return result;
+}
+
+void LILC::LineTable::moveGap(size_t index)
+{
+   while (gapBegin > index){
+      gapBegin--;
+      starts[gapBegin + gapLength] = starts[gapBegin] - shift;
+   }
+   while (gapBegin < index){
+      starts[gapBegin] = starts[gapBegin + gapLength] + shift;
+      gapBegin++;
+   }
+}
+
+void LILC::LineTable::edit(const char * text, size_t offset, size_t removed,
+size_t inserted)
+{
+   // Lines starting after a removed newline go; their old starts are
+   // in (offset, offset + removed]
+   moveGap(lineAfter(static_cast<uint32_t>(offset)));
+   while (gapBegin + gapLength < starts.size()
+          && starts[gapBegin + gapLength] + shift <= offset + removed){
+      gapLength++;
+   }
+
+   for (size_t i = offset; i < offset + inserted; i++){
+      if (text[i] != '\n'){
+         continue;
+      }
+      if (gapLength == 0){
+         size_t tail = starts.size() - gapBegin;
+         size_t grown = starts.size() / 8 + 64;
+         starts.resize(starts.size() + grown);
+         std::memmove(starts.data() + gapBegin + grown,
+            starts.data() + gapBegin, tail * sizeof(uint32_t));
+         gapLength = grown;
+      }
+      starts[gapBegin++] = static_cast<uint32_t>(i + 1);
+      gapLength--;
+   }
+   shift += static_cast<uint32_t>(inserted - removed);
+}
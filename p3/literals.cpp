@@ -0,0 +1,33 @@
+#include <cstring>
+
+#include "literals.hpp"
+
+const char * LILC::decodeStringLit(const char * text, size_t length,
+Arena &arena, size_t &decodedLength)
+{
+   // Escapes only ever shrink the text, so the body's length is enough
+   const char * p = text + 1;
+   const char * end = text + length - 1;
+   char * out = static_cast<char *>(arena.allocate(end - p + 1, 1));
+   char * q = out;
+   while (p < end){
+      // Copy up to the next escape in one go
+      const void * slash = std::memchr(p, '\\', end - p);
+      const char * stop = slash == nullptr ? end
+                        : static_cast<const char *>(slash);
+      std::memcpy(q, p, stop - p);
+      q += stop - p;
+      if (stop == end){
+         break;
+      }
+      switch (stop[1]){
+      case 'n': *q++ = '\n'; break;
+      case 't': *q++ = '\t'; break;
+      default:  *q++ = stop[1]; break; // \' \" \? and \\ stand for themselves
+      }
+      p = stop + 2;
+   }
+   *q = '\0';
+   decodedLength = q - out;
+   return out;
+}
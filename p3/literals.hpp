@@ -0,0 +1,59 @@
+#ifndef __LILC_LITERALS_HPP__
+#define __LILC_LITERALS_HPP__ 1
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+
+#include "arena.hpp"
+
+namespace LILC{
+
+/*
+Decoding of literal tokens. The scanner only finds where a literal is;
+its tokens keep the raw source text and these turn it into a value
+when (and if) something asks for one.
+ */
+
+// Whether a run of decimal digits is bigger than INT_MAX, without
+// computing its value: skip leading zeros, then it overflows if more
+// than 10 digits are left, or exactly 10 that compare above INT_MAX.
+inline bool intLitOverflows(const char * text, size_t length){
+	static const char MAX_DIGITS[] = "2147483647";
+	while (length > 1 && *text == '0'){
+		text++;
+		length--;
+	}
+	if (length != sizeof(MAX_DIGITS) - 1){
+		return length > sizeof(MAX_DIGITS) - 1;
+	}
+	for (size_t i = 0; i < length; i++){
+		if (text[i] != MAX_DIGITS[i]){
+			return text[i] > MAX_DIGITS[i];
+		}
+	}
+	return false;
+}
+
+// Value of a run of decimal digits, clamped to INT_MAX, in one pass
+// that stops as soon as the value is known to be too big. overflow is
+// set if it had to be clamped.
+inline int decodeIntLit(const char * text, size_t length, bool &overflow){
+	uint64_t value = 0;
+	for (size_t i = 0; i < length && value <= INT_MAX; i++){
+		value = value * 10 + (text[i] - '0');
+	}
+	overflow = value > INT_MAX;
+	return overflow ? INT_MAX : static_cast<int>(value);
+}
+
+// The characters of a string literal, given its spelling with the
+// quotes and with only the escapes the scanner accepts (\n \t \' \"
+// \? \\). The result is NUL-terminated and allocated from arena;
+// length is set to its length without the NUL.
+const char * decodeStringLit(const char * text, size_t length,
+	Arena &arena, size_t &decodedLength);
+
+} /* end namespace */
+
+#endif /* END __LILC_LITERALS_HPP__ */
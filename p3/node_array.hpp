@@ -0,0 +1,122 @@
+#ifndef __LILC_NODE_ARRAY_HPP__
+#define __LILC_NODE_ARRAY_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "arena.hpp"
+
+namespace LILC{
+
+/*
+The children of an AST list node: a contiguous array in the AST arena.
+The node doesn't own it; it goes with the arena like the node does.
+ */
+template <typename T>
+class NodeArray{
+public:
+   typedef T * iterator;
+
+   NodeArray() : items(nullptr), count(0) {}
+   NodeArray(T * items, size_t count)
+   : items(items), count(static_cast<uint32_t>(count)) {}
+
+   iterator begin() const { return items; }
+   iterator end() const { return items + count; }
+   size_t size() const { return count; }
+   bool empty() const { return count == 0; }
+   T & operator[](size_t i) const { return items[i]; }
+private:
+   T * items;
+   uint32_t count;
+};
+
+/*
+Collects the children of a list node while the parser reduces its
+elements, in storage taken from the arena: it doubles when full,
+leaving the old array behind in the arena, so at most as much again
+is wasted. take() hands the array to the node as it is, without a
+copy, and leaves the list empty.
+
+It is a parser semantic value, moved from rule to rule as the list
+grows; copying it would leave two lists sharing one array, so it can
+only be moved. A default-constructed list has no arena and must be
+assigned one before anything is added.
+ */
+template <typename T>
+class NodeList{
+   static_assert(std::is_trivially_copyable<T>::value,
+      "NodeList moves its elements with memcpy");
+public:
+   NodeList() = default;
+   explicit NodeList(Arena &arena) : arena(&arena) {}
+   NodeList(const NodeList&) = delete;
+   NodeList& operator=(const NodeList&) = delete;
+   NodeList(NodeList &&other){ steal(other); }
+   NodeList& operator=(NodeList &&other){
+	if (this != &other){ steal(other); }
+	return *this;
+   }
+
+   void push_back(T item){
+	if (count == capacity){ grow(); }
+	items[count++] = item;
+   }
+
+   // Lists the grammar builds back to front; their elements are
+   // shifted each time, which is fine for argument lists
+   void push_front(T item){
+	if (count == capacity){ grow(); }
+	std::memmove(items + 1, items, count * sizeof(T));
+	items[0] = item;
+	count++;
+   }
+
+   size_t size() const { return count; }
+
+   // Room for n elements in all, taken from the arena at once
+   void reserve(size_t n){
+	if (n > capacity){ resize(n); }
+   }
+
+   NodeArray<T> take(){
+	NodeArray<T> result(items, count);
+	items = nullptr;
+	count = capacity = 0;
+	return result;
+   }
+private:
+   void grow(){
+	resize(capacity == 0 ? 4 : capacity * 2);
+   }
+
+   void resize(size_t larger){
+	T * bigger = static_cast<T *>(
+		arena->allocate(larger * sizeof(T), alignof(T)));
+	if (count > 0){
+		std::memcpy(bigger, items, count * sizeof(T));
+	}
+	items = bigger;
+	capacity = larger;
+   }
+
+   void steal(NodeList &other){
+	arena = other.arena;
+	items = other.items;
+	count = other.count;
+	capacity = other.capacity;
+	other.items = nullptr;
+	other.count = other.capacity = 0;
+   }
+
+   Arena * arena = nullptr;
+   T * items = nullptr;
+   size_t count = 0;
+   size_t capacity = 0;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_NODE_ARRAY_HPP__ */
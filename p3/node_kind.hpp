@@ -0,0 +1,129 @@
+#ifndef __LILC_NODE_KIND_HPP__
+#define __LILC_NODE_KIND_HPP__ 1
+
+#include <cstdint>
+#include <type_traits>
+
+namespace LILC{
+
+/*
+What an AST node is, one value per concrete node class in ast.hpp, in
+the order they are listed there. Every node records its kind, which is
+what ASTVisitor switches on; it fits in a byte so that the flat AST
+(flat_ast.hpp) can keep a column of them.
+ */
+enum class NodeKind : uint8_t {
+	PROGRAM,
+	DECL_LIST,
+	VAR_DECL,
+	FN_DECL,
+	FORMAL_DECL,
+	STRUCT_DECL,
+	FORMALS_LIST,
+	FN_BODY,
+	STMT_LIST,
+	EXP_LIST,
+	INT_TYPE,
+	BOOL_TYPE,
+	VOID_TYPE,
+	STRUCT_TYPE,
+	ASSIGN_STMT,
+	POST_INC_STMT,
+	POST_DEC_STMT,
+	READ_STMT,
+	WRITE_STMT,
+	IF_STMT,
+	IF_ELSE_STMT,
+	WHILE_STMT,
+	CALL_STMT,
+	RETURN_STMT,
+	INT_LIT,
+	STR_LIT,
+	TRUE_LIT,
+	FALSE_LIT,
+	ID,
+	DOT_ACCESS,
+	ASSIGN,
+	CALL_EXP,
+	UNARY_MINUS,
+	NOT,
+	PLUS,
+	MINUS,
+	TIMES,
+	DIVIDE,
+	AND,
+	OR,
+	EQUALS,
+	NOT_EQUALS,
+	LESS,
+	GREATER,
+	LESS_EQ,
+	GREATER_EQ,
+};
+
+const int NODE_KIND_COUNT = static_cast<int>(NodeKind::GREATER_EQ) + 1;
+
+// A kind as a type, for code written once per kind
+template <NodeKind K>
+using KindTag = std::integral_constant<NodeKind, K>;
+
+/*
+Calls f(KindTag<K>()) for the K that kind is. f is usually a generic
+lambda, so it is compiled once for every kind with K a constant, and
+switches on K in it cost nothing; the switch here is the only one.
+ */
+template <typename F>
+inline void withKind(NodeKind kind, F && f){
+	switch (kind){
+	case NodeKind::PROGRAM: f(KindTag<NodeKind::PROGRAM>()); return;
+	case NodeKind::DECL_LIST: f(KindTag<NodeKind::DECL_LIST>()); return;
+	case NodeKind::VAR_DECL: f(KindTag<NodeKind::VAR_DECL>()); return;
+	case NodeKind::FN_DECL: f(KindTag<NodeKind::FN_DECL>()); return;
+	case NodeKind::FORMAL_DECL: f(KindTag<NodeKind::FORMAL_DECL>()); return;
+	case NodeKind::STRUCT_DECL: f(KindTag<NodeKind::STRUCT_DECL>()); return;
+	case NodeKind::FORMALS_LIST: f(KindTag<NodeKind::FORMALS_LIST>()); return;
+	case NodeKind::FN_BODY: f(KindTag<NodeKind::FN_BODY>()); return;
+	case NodeKind::STMT_LIST: f(KindTag<NodeKind::STMT_LIST>()); return;
+	case NodeKind::EXP_LIST: f(KindTag<NodeKind::EXP_LIST>()); return;
+	case NodeKind::INT_TYPE: f(KindTag<NodeKind::INT_TYPE>()); return;
+	case NodeKind::BOOL_TYPE: f(KindTag<NodeKind::BOOL_TYPE>()); return;
+	case NodeKind::VOID_TYPE: f(KindTag<NodeKind::VOID_TYPE>()); return;
+	case NodeKind::STRUCT_TYPE: f(KindTag<NodeKind::STRUCT_TYPE>()); return;
+	case NodeKind::ASSIGN_STMT: f(KindTag<NodeKind::ASSIGN_STMT>()); return;
+	case NodeKind::POST_INC_STMT: f(KindTag<NodeKind::POST_INC_STMT>()); return;
+	case NodeKind::POST_DEC_STMT: f(KindTag<NodeKind::POST_DEC_STMT>()); return;
+	case NodeKind::READ_STMT: f(KindTag<NodeKind::READ_STMT>()); return;
+	case NodeKind::WRITE_STMT: f(KindTag<NodeKind::WRITE_STMT>()); return;
+	case NodeKind::IF_STMT: f(KindTag<NodeKind::IF_STMT>()); return;
+	case NodeKind::IF_ELSE_STMT: f(KindTag<NodeKind::IF_ELSE_STMT>()); return;
+	case NodeKind::WHILE_STMT: f(KindTag<NodeKind::WHILE_STMT>()); return;
+	case NodeKind::CALL_STMT: f(KindTag<NodeKind::CALL_STMT>()); return;
+	case NodeKind::RETURN_STMT: f(KindTag<NodeKind::RETURN_STMT>()); return;
+	case NodeKind::INT_LIT: f(KindTag<NodeKind::INT_LIT>()); return;
+	case NodeKind::STR_LIT: f(KindTag<NodeKind::STR_LIT>()); return;
+	case NodeKind::TRUE_LIT: f(KindTag<NodeKind::TRUE_LIT>()); return;
+	case NodeKind::FALSE_LIT: f(KindTag<NodeKind::FALSE_LIT>()); return;
+	case NodeKind::ID: f(KindTag<NodeKind::ID>()); return;
+	case NodeKind::DOT_ACCESS: f(KindTag<NodeKind::DOT_ACCESS>()); return;
+	case NodeKind::ASSIGN: f(KindTag<NodeKind::ASSIGN>()); return;
+	case NodeKind::CALL_EXP: f(KindTag<NodeKind::CALL_EXP>()); return;
+	case NodeKind::UNARY_MINUS: f(KindTag<NodeKind::UNARY_MINUS>()); return;
+	case NodeKind::NOT: f(KindTag<NodeKind::NOT>()); return;
+	case NodeKind::PLUS: f(KindTag<NodeKind::PLUS>()); return;
+	case NodeKind::MINUS: f(KindTag<NodeKind::MINUS>()); return;
+	case NodeKind::TIMES: f(KindTag<NodeKind::TIMES>()); return;
+	case NodeKind::DIVIDE: f(KindTag<NodeKind::DIVIDE>()); return;
+	case NodeKind::AND: f(KindTag<NodeKind::AND>()); return;
+	case NodeKind::OR: f(KindTag<NodeKind::OR>()); return;
+	case NodeKind::EQUALS: f(KindTag<NodeKind::EQUALS>()); return;
+	case NodeKind::NOT_EQUALS: f(KindTag<NodeKind::NOT_EQUALS>()); return;
+	case NodeKind::LESS: f(KindTag<NodeKind::LESS>()); return;
+	case NodeKind::GREATER: f(KindTag<NodeKind::GREATER>()); return;
+	case NodeKind::LESS_EQ: f(KindTag<NodeKind::LESS_EQ>()); return;
+	case NodeKind::GREATER_EQ: f(KindTag<NodeKind::GREATER_EQ>()); return;
+	}
+}
+
+} /* end namespace */
+
+#endif /* END __LILC_NODE_KIND_HPP__ */
@@ -0,0 +1,56 @@
+#include <algorithm>
+#include <fstream>
+
+#include "output_buffer.hpp"
+
+#ifndef _WIN32
+#include <cerrno>
+#include <climits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#endif
+
+bool LILC::OutputBuffer::writeAll(const char * path,
+const std::vector<OutputBuffer> & parts)
+{
+#ifdef _WIN32
+   std::ofstream out(path, std::ios::binary);
+   for (const OutputBuffer & part : parts){
+      out.write(part.data(), static_cast<std::streamsize>(part.size()));
+   }
+   return out.good();
+#else
+   int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+   if (fd < 0){ return false; }
+   std::vector<iovec> pending;
+   for (const OutputBuffer & part : parts){
+      if (part.size() == 0){ continue; }
+      iovec v = { const_cast<char *>(part.data()), part.size() };
+      pending.push_back(v);
+   }
+   // A write can stop short, and takes at most IOV_MAX pieces
+   size_t first = 0;
+   bool ok = true;
+   while (first < pending.size()){
+      size_t count = std::min(pending.size() - first, size_t(IOV_MAX));
+      ssize_t n = writev(fd, &pending[first], static_cast<int>(count));
+      if (n < 0){
+         if (errno == EINTR){ continue; }
+         ok = false;
+         break;
+      }
+      size_t written = static_cast<size_t>(n);
+      while (first < pending.size() && written >= pending[first].iov_len){
+         written -= pending[first].iov_len;
+         first++;
+      }
+      if (written > 0){
+         pending[first].iov_base =
+            static_cast<char *>(pending[first].iov_base) + written;
+         pending[first].iov_len -= written;
+      }
+   }
+   return close(fd) == 0 && ok;
+#endif
+}
@@ -0,0 +1,125 @@
+#ifndef __LILC_OUTPUT_BUFFER_HPP__
+#define __LILC_OUTPUT_BUFFER_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <vector>
+
+namespace LILC{
+
+/*
+Append-only text buffer for output that is built in many small pieces,
+such as unparse's. Appending is a bounds check and a copy, with none of
+an ostream's per-insertion overhead; the whole text goes to the stream
+in a single write on flush (or destruction). Indentation is copied from
+a run of spaces and integers are formatted by hand.
+
+A buffer made without a stream just keeps its text, for the caller to
+write out with others (writeAll) once they are all done.
+ */
+class OutputBuffer{
+public:
+	OutputBuffer() = default;
+	explicit OutputBuffer(std::ostream & out) : out(&out){}
+	~OutputBuffer(){ flush(); std::free(text); }
+	OutputBuffer(const OutputBuffer&) = delete;
+	OutputBuffer& operator=(const OutputBuffer&) = delete;
+	OutputBuffer(OutputBuffer && other)
+	: out(other.out), text(other.text), used(other.used),
+	  capacity(other.capacity){
+		other.out = nullptr;
+		other.text = nullptr;
+		other.used = other.capacity = 0;
+	}
+
+	void write(const char * chars, size_t length){
+		std::memcpy(reserve(length), chars, length);
+		used += length;
+	}
+	// A literal, whose length is known without looking
+	template <size_t N>
+	OutputBuffer & operator<<(const char (&literal)[N]){
+		write(literal, N - 1);
+		return *this;
+	}
+	OutputBuffer & operator<<(const char * chars){
+		write(chars, std::strlen(chars));
+		return *this;
+	}
+	OutputBuffer & operator<<(int value);
+
+	void spaces(size_t count){
+		static const char run[] =
+			"                                                                ";
+		const size_t RUN = sizeof(run) - 1;
+		while (count > 0){
+			size_t n = count < RUN ? count : RUN;
+			write(run, n);
+			count -= n;
+		}
+	}
+
+	void flush();
+
+	// Text not yet written
+	const char * data() const { return text; }
+	size_t size() const { return used; }
+
+	// Write the text of parts to a new file at path, in order, with
+	// gathered writes straight from the buffers
+	static bool writeAll(const char * path,
+		const std::vector<OutputBuffer> & parts);
+private:
+	char * reserve(size_t n){
+		if (n > capacity - used){ grow(n); }
+		return text + used;
+	}
+	void grow(size_t n);
+
+	std::ostream * out = nullptr;
+	char * text = nullptr;
+	size_t used = 0;
+	size_t capacity = 0;
+};
+
+inline OutputBuffer & OutputBuffer::operator<<(int value){
+	char digits[11];
+	char * end = digits + sizeof(digits);
+	char * p = end;
+	// In unsigned arithmetic, so that INT_MIN negates
+	uint32_t v = static_cast<uint32_t>(value);
+	if (value < 0){ v = 0u - v; }
+	do {
+		*--p = static_cast<char>('0' + v % 10);
+		v /= 10;
+	} while (v != 0);
+	char * at = reserve(sizeof(digits) + 1);
+	if (value < 0){ *at++ = '-'; used++; }
+	std::memcpy(at, p, end - p);
+	used += end - p;
+	return *this;
+}
+
+inline void OutputBuffer::grow(size_t n){
+	size_t size = capacity == 0 ? 64 * 1024 : capacity * 2;
+	while (size - used < n){ size *= 2; }
+	char * bigger = static_cast<char *>(std::realloc(text, size));
+	if (bigger == nullptr){ throw std::bad_alloc(); }
+	text = bigger;
+	capacity = size;
+}
+
+inline void OutputBuffer::flush(){
+	if (out != nullptr && used > 0){
+		out->write(text, static_cast<std::streamsize>(used));
+		used = 0;
+	}
+}
+
+} /* end namespace */
+
+#endif /* END __LILC_OUTPUT_BUFFER_HPP__ */
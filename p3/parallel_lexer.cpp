@@ -0,0 +1,111 @@
+/*
+Chunked, multi-threaded tokenize. No LilC token contains a line break:
+comments and string literals (terminated or not) end at the first
+newline, and nothing else can include one. So the state of either
+scanner backend right after a newline is the same as at the start of
+a file, and a chunk that begins just after a newline lexes exactly as
+it would have as part of the whole buffer, comment or string on the
+line before it notwithstanding. That makes newlines the only
+resynchronization points needed.
+
+Each chunk is lexed by its own scanner into its own token buffer and
+diagnostics stream; afterwards the buffers are appended in order.
+Chunk scanners locate tokens by offset in the whole buffer and share
+its line table, so they need no line numbers handed down. The
+one thing that crosses a chunk boundary is a string literal error that
+ends the scan (lilc.l returns 0 for it), after which the sequential
+scanner reports nothing more, so later chunks are thrown away.
+ */
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+#include "lilc_scanner.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+namespace {
+
+// Below this a chunk isn't worth a scanner of its own
+const size_t MIN_CHUNK = 256 * 1024;
+// Chunks per thread, so one slow chunk doesn't hold up the rest
+const size_t CHUNKS_PER_THREAD = 4;
+
+struct Chunk{
+	size_t begin;
+	size_t end;
+	LILC::TokenBuffer tokens;
+	std::ostringstream diagnostics;
+};
+
+} // end anonymous namespace
+
+void LILC::LilC_Scanner::tokenizeParallel(ThreadPool &pool)
+{
+   const size_t size = static_cast<size_t>(bufferEnd - bufferStart);
+   size_t wanted = std::min(pool.size() * CHUNKS_PER_THREAD,
+      size / MIN_CHUNK);
+   if (pool.size() < 2 || wanted < 2){
+      tokenize();
+      return;
+   }
+
+   // Cut after the first newline at or past each even split point
+   std::vector<Chunk> chunks(wanted);
+   size_t count = 0;
+   size_t begin = 0;
+   for (size_t i = 1; i <= wanted && begin < size; i++){
+      size_t end = size;
+      if (i < wanted){
+         size_t split = std::max(begin, size / wanted * i);
+         const void * newline = std::memchr(bufferStart + split, '\n',
+            size - split);
+         if (newline != nullptr){
+            end = static_cast<const char *>(newline) - bufferStart + 1;
+         }
+      }
+      chunks[count].begin = begin;
+      chunks[count].end = end;
+      count++;
+      begin = end;
+   }
+   chunks.resize(count);
+
+   pool.forEach(count, [&](size_t i){
+      Chunk &chunk = chunks[i];
+      // flex writes into the buffer as it scans and wants two NULs
+      // after it, so each chunk gets a private copy
+      std::string text(bufferStart + chunk.begin, chunk.end - chunk.begin);
+      text.append(2, '\0');
+      // tokenize builds no tokens, so the shared arena and interner
+      // are never touched from here
+      LilC_Scanner part(tokens, names);
+      part.switchToBuffer(&text[0], text.size() - 2);
+      part.lines = lines;
+      part.locBase = locBase + static_cast<uint32_t>(chunk.begin);
+      part.setBackend(backend);
+      part.setDiagnostics(chunk.diagnostics);
+      part.tokenize();
+      chunk.tokens = std::move(part.batch);
+   });
+
+   batch.clear();
+   batchNext = 0;
+   batch.reserve(size / 4 + 1);
+   for (Chunk &chunk : chunks){
+      *diagnostics << chunk.diagnostics.str();
+      TokenBuffer &part = chunk.tokens;
+      size_t last = part.size() - 1;
+      for (size_t i = 0; i < last; i++){
+         batch.push(part.tags[i], part.starts[i], part.lengths[i]);
+      }
+      // Every chunk ends with END; keep it only where the scan stops
+      bool stopped = part.starts[last] < locBase + chunk.end;
+      if (stopped || &chunk == &chunks.back()){
+         batch.push(TokenTag::END, part.starts[last], 0);
+         break;
+      }
+   }
+   resetGap();
+}
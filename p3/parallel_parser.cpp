@@ -0,0 +1,193 @@
+/*
+Chunked, multi-threaded parse. A program is a list of top-level
+declarations, and each one parses the same whatever comes before or
+after it, so the token stream can be cut between two declarations and
+the pieces parsed on their own. Where declarations end is found from
+the token tags alone, by brace depth: at depth 0 a semicolon ends a
+variable or struct declaration, and a closing brace that comes back
+to depth 0 ends a function, unless a semicolon (a struct's) follows.
+
+The stream is cut at such ends into chunks of about equal numbers of
+tokens. Each chunk is a list of whole declarations, which is itself a
+program, so it gets a scanner handing out just its tokens, a parser of
+its own and an arena for its nodes, and its declarations are then
+joined, in order, into one ProgramNode: the tree a single parser
+would have built.
+
+The chunk parsers share nothing that changes. The identifiers are
+interned up front, in token order, so their atoms are the ones a
+sequential parse would have made, and the chunk scanners take those
+instead of interning. Diagnostics are kept aside, and if any chunk
+fails to parse (or the braces don't balance) the caller parses the
+whole stream again with one parser, which reports the errors exactly
+as it always has.
+ */
+#include <algorithm>
+#include <sstream>
+
+#include "lilc_compiler.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+namespace {
+
+// Below this many tokens a chunk isn't worth a parser of its own
+const size_t MIN_CHUNK = 64 * 1024;
+// Chunks per thread, so one slow chunk doesn't hold up the rest
+const size_t CHUNKS_PER_THREAD = 4;
+
+struct Chunk{
+	// Tokens [begin, end) of the stream
+	size_t begin;
+	size_t end;
+	// Identifiers before begin
+	size_t firstAtom;
+	LILC::ProgramNode * root = nullptr;
+	bool parsed = false;
+	std::ostringstream diagnostics;
+};
+
+// Cut stream at the end of the first top-level declaration at or past
+// each of wanted even split points. False if the braces don't balance
+// or it comes to a single chunk.
+bool splitDeclarations(const LILC::TokenBuffer &stream, size_t wanted,
+std::vector<Chunk> &chunks)
+{
+   // Tokens before the END that closes the stream
+   const size_t count = stream.size() - 1;
+   const uint16_t * tags = stream.tags.data();
+   const size_t step = count / wanted;
+   size_t next = step;
+   size_t begin = 0;
+   size_t firstAtom = 0;
+   size_t ids = 0;
+   long depth = 0;
+   auto cut = [&](size_t end){
+      chunks.emplace_back();
+      chunks.back().begin = begin;
+      chunks.back().end = end;
+      chunks.back().firstAtom = firstAtom;
+      begin = end;
+      firstAtom = ids;
+   };
+   for (size_t i = 0; i < count; i++){
+      switch (tags[i]){
+      case TokenTag::ID:
+         ids++;
+         continue;
+      case TokenTag::LCURLY:
+         depth++;
+         continue;
+      case TokenTag::RCURLY:
+         if (--depth < 0){ return false; }
+         if (depth > 0 || tags[i + 1] == TokenTag::SEMICOLON){ continue; }
+         break;
+      case TokenTag::SEMICOLON:
+         if (depth > 0){ continue; }
+         break;
+      default:
+         continue;
+      }
+      // Token i ends a top-level declaration
+      if (i + 1 >= next && i + 1 < count){
+         cut(i + 1);
+         while (next <= i + 1){ next += step; }
+      }
+   }
+   if (depth != 0){
+      return false;
+   }
+   cut(count);
+   return chunks.size() > 1;
+}
+
+} // end anonymous namespace
+
+void LILC::LilC_Scanner::internIdentifiers(std::vector<Atom> &atoms)
+{
+   closeGap();
+   atoms.clear();
+   for (size_t i = 0; i < batch.size(); i++){
+      if (batch.tags[i] == TokenTag::ID){
+         const char * text = bufferStart + (batch.starts[i] - locBase);
+         atoms.push_back(names.intern(text, batch.lengths[i]));
+      }
+   }
+}
+
+void LILC::LilC_Scanner::followTokens(const LilC_Scanner &whole,
+size_t begin, size_t end, const Atom * atoms)
+{
+   // whole's stream may still have relex's gap in it
+   const TokenBuffer &stream = whole.batch;
+   batch.clear();
+   batchNext = 0;
+   batch.reserve(end - begin + 1);
+   for (size_t i = begin; i < end; i++){
+      size_t at = i < whole.gapBegin ? i : i + whole.gapLength;
+      batch.push(stream.tags[at], whole.tokenOffset(i), stream.lengths[at]);
+   }
+   batch.push(TokenTag::END, whole.tokenOffset(end), 0);
+   resetGap();
+   bufferStart = whole.bufferStart;
+   bufferEnd = whole.bufferEnd;
+   lines = whole.lines;
+   locBase = whole.locBase;
+   this->atoms = atoms;
+}
+
+bool LILC::LilC_Compiler::parseInParallel( ThreadPool & pool )
+{
+   const TokenBuffer & stream = scanner->tokenBuffer();
+   size_t wanted = std::min( pool.size() * CHUNKS_PER_THREAD,
+                             stream.size() / MIN_CHUNK );
+   std::vector<Chunk> chunks;
+   if( pool.size() < 2 || wanted < 2
+       || ! splitDeclarations( stream, wanted, chunks ) ) {
+      return false;
+   }
+
+   std::vector<Atom> atoms;
+   scanner->internIdentifiers( atoms );
+   while( partNodes.size() < chunks.size() ) {
+      partNodes.push_back( new Arena() );
+   }
+
+   pool.forEach( chunks.size(), [&]( size_t i ){
+      Chunk & chunk = chunks[i];
+      Arena & arena = *partNodes[i];
+      // The chunk's tokens die with it: nodes copy what they keep
+      Arena chunkTokens;
+      LilC_Scanner part( chunkTokens, names );
+      part.followTokens( *scanner, chunk.begin, chunk.end,
+                         atoms.data() + chunk.firstAtom );
+      part.setDiagnostics( chunk.diagnostics );
+      ExpTable unshared( arena );
+      chunk.parsed = parseWith( part, chunk.root, arena, unshared );
+   } );
+
+   for( const Chunk & chunk : chunks ) {
+      if( ! chunk.parsed ) {
+         resetParts();
+         return false;
+      }
+   }
+
+   size_t total = 0;
+   for( const Chunk & chunk : chunks ) {
+      total += chunk.root->declList()->decls().size();
+   }
+   NodeList<DeclNode *> decls( nodes );
+   decls.reserve( total );
+   for( const Chunk & chunk : chunks ) {
+      for( DeclNode * decl : chunk.root->declList()->decls() ) {
+         decls.push_back( decl );
+      }
+   }
+   // Every chunk starts where a whole program would, so the first
+   // one's locations are the program's
+   ProgramNode * first = chunks.front().root;
+   astRoot = nodes.make<ProgramNode>( first->loc(),
+      nodes.make<DeclListNode>( first->declList()->loc(), std::move( decls ) ) );
+   return true;
+}
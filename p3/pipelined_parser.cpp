@@ -0,0 +1,84 @@
+/*
+Lexing and parsing at the same time. The scanner the compiler set up
+lexes on a thread of its own, handing its tokens over in batches
+through a TokenRing, and the parser, on the calling thread, reads them
+with a second scanner whose bufferedLex takes the next batch from the
+ring whenever the one it has runs out. The parser pulls its tokens as
+it always has (Bison's push interface is for C parsers only), but it
+starts on the first batch instead of the whole stream, so the two
+passes overlap, and the tokens in flight are bounded by the ring
+rather than growing with the input.
+
+Diagnostics come out as they would from lexing everything first and
+then parsing: the lexer reports as it goes, the parser's syntax error
+is kept aside until the lexer has finished, and a parser that stops
+early quits the ring, leaving the lexer to run on for its diagnostics
+alone.
+ */
+#include <sstream>
+#include <thread>
+
+#include "lilc_compiler.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+void LILC::LilC_Scanner::tokenizeInto(TokenRing &ring)
+{
+   TokenBuffer * out = ring.claim();
+   while (true){
+      int tag = backend == Backend::SIMD ? simdLex(nullptr) : flexLex(nullptr);
+      bool end = tag == TokenTag::END;
+      if (out != nullptr){
+         // END goes after the last match, as in tokenize
+         if (end){
+            out->push(tag, locAt(tokenStart + tokenLength).offset, 0);
+         } else {
+            out->push(tag, locAt(tokenStart).offset,
+               static_cast<uint32_t>(tokenLength));
+         }
+         if (end || out->size() == TokenRing::BATCH){
+            ring.publish();
+            out = end ? nullptr : ring.claim();
+         }
+      }
+      if (end){
+         break;
+      }
+   }
+   ring.finish();
+}
+
+void LILC::LilC_Scanner::followRing(const LilC_Scanner &whole,
+TokenRing &ring)
+{
+   batch.clear();
+   batchNext = 0;
+   resetGap();
+   bufferStart = whole.bufferStart;
+   bufferEnd = whole.bufferEnd;
+   lines = whole.lines;
+   locBase = whole.locBase;
+   atoms = nullptr;
+   this->ring = &ring;
+}
+
+bool LILC::LilC_Compiler::parsePipelined()
+{
+   TokenRing ring;
+   LilC_Scanner reader( tokens, names );
+   reader.followRing( *scanner, ring );
+   std::ostringstream syntaxErrors;
+   reader.setDiagnostics( syntaxErrors );
+
+   std::thread lexer( [&]{ scanner->tokenizeInto( ring ); } );
+   bool parsed = parseWith( reader, astRoot, nodes, exps );
+   ring.quit();
+   lexer.join();
+
+   std::cerr << syntaxErrors.str();
+   if( ! parsed )
+   {
+      std::cerr << "Parse failed!!\n";
+   }
+   return parsed;
+}
@@ -0,0 +1,361 @@
+/*
+Hand-written scanner backend. It accepts exactly the language of lilc.l
+and reports the same diagnostics at the same positions, so either
+backend can sit behind LilC_Scanner::yylex. Runs of blanks, identifier
+and digit characters, comment bodies and string literal bodies are
+measured 16 (SSE2) or 32 (AVX2) bytes at a time; everything else is a
+plain switch on the current character.
+ */
+#include <string>
+
+#include "lilc_scanner.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define LILC_HAVE_X86 1
+#endif
+
+using TokenTag = LILC::LilC_Parser::token;
+
+namespace {
+
+// Classes of characters that are consumed as runs
+enum Run { BLANKS, IDENT_CHARS, DIGITS, COMMENT_BODY, STRING_BODY };
+
+template <Run R>
+inline bool inRun(unsigned char c){
+	switch (R){
+	case BLANKS: return c == ' ' || c == '\t';
+	case IDENT_CHARS: return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+		|| (c >= '0' && c <= '9') || c == '_';
+	case DIGITS: return c >= '0' && c <= '9';
+	case COMMENT_BODY: return c != '\n';
+	case STRING_BODY: return c != '\n' && c != '"' && c != '\\';
+	}
+	return false;
+}
+
+template <Run R>
+const char * scalarRun(const char * p, const char * end){
+	while (p < end && inRun<R>(*p)){ p++; }
+	return p;
+}
+
+#ifdef LILC_HAVE_X86
+
+// Byte lanes of v in [lo, hi], as all-ones lanes
+inline __m128i inRange16(__m128i v, char lo, char hi){
+	__m128i shifted = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+	__m128i over = _mm_subs_epu8(shifted, _mm_set1_epi8(hi - lo));
+	return _mm_cmpeq_epi8(over, _mm_setzero_si128());
+}
+
+template <Run R>
+inline unsigned runMask16(__m128i v){
+	__m128i in;
+	switch (R){
+	case BLANKS:
+		in = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('\t')));
+		break;
+	case IDENT_CHARS: {
+		// Setting bit 5 folds upper case onto lower case
+		__m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+		in = _mm_or_si128(inRange16(lower, 'a', 'z'),
+			_mm_or_si128(inRange16(v, '0', '9'),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('_'))));
+		break;
+	}
+	case DIGITS:
+		in = inRange16(v, '0', '9');
+		break;
+	case COMMENT_BODY:
+		in = _mm_cmpeq_epi8(v, _mm_set1_epi8('\n'));
+		return ~static_cast<unsigned>(_mm_movemask_epi8(in)) & 0xFFFF;
+	case STRING_BODY:
+		in = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')),
+			_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+			_mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))));
+		return ~static_cast<unsigned>(_mm_movemask_epi8(in)) & 0xFFFF;
+	}
+	return static_cast<unsigned>(_mm_movemask_epi8(in));
+}
+
+template <Run R>
+const char * sse2Run(const char * p, const char * end){
+	while (end - p >= 16){
+		__m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+		unsigned out = ~runMask16<R>(v) & 0xFFFF;
+		if (out != 0){ return p + __builtin_ctz(out); }
+		p += 16;
+	}
+	return scalarRun<R>(p, end);
+}
+
+__attribute__((target("avx2")))
+inline __m256i inRange32(__m256i v, char lo, char hi){
+	__m256i shifted = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+	__m256i over = _mm256_subs_epu8(shifted, _mm256_set1_epi8(hi - lo));
+	return _mm256_cmpeq_epi8(over, _mm256_setzero_si256());
+}
+
+template <Run R>
+__attribute__((target("avx2")))
+inline uint32_t runMask32(__m256i v){
+	__m256i in;
+	switch (R){
+	case BLANKS:
+		in = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\t')));
+		break;
+	case IDENT_CHARS: {
+		__m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+		in = _mm256_or_si256(inRange32(lower, 'a', 'z'),
+			_mm256_or_si256(inRange32(v, '0', '9'),
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'))));
+		break;
+	}
+	case DIGITS:
+		in = inRange32(v, '0', '9');
+		break;
+	case COMMENT_BODY:
+		in = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'));
+		return ~static_cast<uint32_t>(_mm256_movemask_epi8(in));
+	case STRING_BODY:
+		in = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')),
+			_mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+			_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))));
+		return ~static_cast<uint32_t>(_mm256_movemask_epi8(in));
+	}
+	return static_cast<uint32_t>(_mm256_movemask_epi8(in));
+}
+
+template <Run R>
+__attribute__((target("avx2")))
+const char * avx2Run(const char * p, const char * end){
+	while (end - p >= 32){
+		__m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+		uint32_t out = ~runMask32<R>(v);
+		if (out != 0){ return p + __builtin_ctz(out); }
+		p += 32;
+	}
+	return sse2Run<R>(p, end);
+}
+
+bool detectAVX2(){
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2");
+}
+
+const bool haveAVX2 = detectAVX2();
+
+#endif // LILC_HAVE_X86
+
+// End of the run of R characters starting at p. Never reads at or past
+// end, so the caller's buffer needs no padding.
+template <Run R>
+inline const char * run(const char * p, const char * end){
+#ifdef LILC_HAVE_X86
+	// Many runs are empty; don't bother going wide for those
+	if (p < end && !inRun<R>(*p)){ return p; }
+	return haveAVX2 ? avx2Run<R>(p, end) : sse2Run<R>(p, end);
+#else
+	return scalarRun<R>(p, end);
+#endif
+}
+
+// Characters allowed after a backslash in a string literal
+inline bool isEscapedChar(char c){
+	return c == 'n' || c == 't' || c == '\'' || c == '"' || c == '?'
+		|| c == '\\';
+}
+
+// Body of a string literal as in lilc.l: characters other than newline,
+// quote and backslash, or a backslash followed by an escapable character
+const char * goodStringRun(const char * p, const char * end){
+	while (true){
+		p = run<STRING_BODY>(p, end);
+		if (p + 1 < end && *p == '\\' && isEscapedChar(p[1])){
+			p += 2;
+			continue;
+		}
+		return p;
+	}
+}
+
+struct Keyword{
+	const char * text;
+	int tag;
+};
+
+const Keyword keywords[] = {
+	{ "bool", TokenTag::BOOL },
+	{ "void", TokenTag::VOID },
+	{ "int", TokenTag::INT },
+	{ "true", TokenTag::TRUE },
+	{ "false", TokenTag::FALSE },
+	{ "struct", TokenTag::STRUCT },
+	{ "cin", TokenTag::INPUT },
+	{ "cout", TokenTag::OUTPUT },
+	{ "if", TokenTag::IF },
+	{ "else", TokenTag::ELSE },
+	{ "while", TokenTag::WHILE },
+	{ "return", TokenTag::RETURN },
+};
+
+// Keyword tag for the identifier [start, start+length), or ID
+int keywordTag(const char * start, size_t length){
+	if (length < 2 || length > 6){ return TokenTag::ID; }
+	for (const Keyword & k : keywords){
+		if (k.text[0] == start[0] && std::char_traits<char>::length(k.text) == length
+		    && std::char_traits<char>::compare(k.text, start, length) == 0){
+			return k.tag;
+		}
+	}
+	return TokenTag::ID;
+}
+
+} // end anonymous namespace
+
+int LILC::LilC_Scanner::simdLex( LILC::LilC_Parser::semantic_type * const lval )
+{
+	yylval = lval;
+	const char * p = cursor;
+	const char * const end = bufferEnd;
+
+	while (p < end){
+		const char * start = p;
+		// Consume the match [start, to) and return its length
+		auto take = [&](const char * to){
+			cursor = to;
+			markToken(start, to - start);
+			return static_cast<size_t>(to - start);
+		};
+		// The same for a token whose value is just its tag
+		auto nullary = [&](int tag, const char * to){
+			take(to);
+			return produceNullaryToken(tag);
+		};
+		char c = *p;
+		switch (c){
+		case '\n':
+			p++;
+			continue;
+		case ' ':
+		case '\t':
+			p = run<BLANKS>(p, end);
+			continue;
+		case '#':
+			p = run<COMMENT_BODY>(p, end);
+			continue;
+		case '/':
+			if (p + 1 < end && p[1] == '/'){
+				p = run<COMMENT_BODY>(p, end);
+				continue;
+			}
+			return nullary(TokenTag::DIVIDE, p + 1);
+		case '"': {
+			const char * body = goodStringRun(p + 1, end);
+			if (body < end && *body == '"'){
+				return produceStringLitToken(start, take(body + 1));
+			}
+			if (body + 1 < end && *body == '\\' && body[1] != '\n'){
+				// A bad escape. Two rules can match from here, and flex
+				// takes the longer: the literal closed by the next quote
+				// on the line, a bad token, or the run of more good
+				// characters after the escape, which may step over that
+				// quote as an escaped one. A tie goes to the first.
+				const char * q = body + 2;
+				while (q < end && *q != '\n' && *q != '"'){ q++; }
+				p = goodStringRun(body + 2, end);
+				if (p < end && *p == '\\'){ p++; }
+				if (q < end && *q == '"' && q + 1 >= p){
+					take(q + 1);
+					error(locAt(start), "string literal with bad escaped character ignored");
+					return 0;
+				}
+				error(locAt(p), "unterminated string literal with bad"
+					"escaped character ignored");
+				continue;
+			}
+			if (body < end && *body == '\\'){
+				// Backslash right before the end of the line
+				p = body + 1;
+				error(locAt(p), "unterminated string literal with bad"
+					"escaped character ignored");
+				continue;
+			}
+			take(body);
+			error(locAt(start), "unterminated string literal ignored");
+			return 0;
+		}
+		case '{': return nullary(TokenTag::LCURLY, p + 1);
+		case '}': return nullary(TokenTag::RCURLY, p + 1);
+		case '(': return nullary(TokenTag::LPAREN, p + 1);
+		case ')': return nullary(TokenTag::RPAREN, p + 1);
+		case ';': return nullary(TokenTag::SEMICOLON, p + 1);
+		case ',': return nullary(TokenTag::COMMA, p + 1);
+		case '.': return nullary(TokenTag::DOT, p + 1);
+		case '*': return nullary(TokenTag::TIMES, p + 1);
+		default:
+			break;
+		}
+
+		// Operators that may be one or two characters long
+		char next = p + 1 < end ? p[1] : '\0';
+		int tag = 0;
+		size_t length = 2;
+		switch (c){
+		case '<': tag = next == '<' ? TokenTag::WRITE
+			: next == '=' ? TokenTag::LESSEQ : TokenTag::LESS; break;
+		case '>': tag = next == '>' ? TokenTag::READ
+			: next == '=' ? TokenTag::GREATEREQ : TokenTag::GREATER; break;
+		case '+': tag = next == '+' ? TokenTag::PLUSPLUS : TokenTag::PLUS; break;
+		case '-': tag = next == '-' ? TokenTag::MINUSMINUS : TokenTag::MINUS; break;
+		case '!': tag = next == '=' ? TokenTag::NOTEQUALS : TokenTag::NOT; break;
+		case '=': tag = next == '=' ? TokenTag::EQUALS : TokenTag::ASSIGN; break;
+		case '&': tag = next == '&' ? TokenTag::AND : 0; break;
+		case '|': tag = next == '|' ? TokenTag::OR : 0; break;
+		default: break;
+		}
+		if (tag != 0){
+			switch (tag){
+			case TokenTag::LESS: case TokenTag::GREATER: case TokenTag::PLUS:
+			case TokenTag::MINUS: case TokenTag::NOT: case TokenTag::ASSIGN:
+				length = 1;
+				break;
+			default:
+				break;
+			}
+			return nullary(tag, p + length);
+		}
+
+		unsigned char u = static_cast<unsigned char>(c);
+		if (u >= '0' && u <= '9'){
+			p = run<DIGITS>(p, end);
+			if (intLitOverflows(start, p - start)){
+				std::string msg = "Integer literal too large;"
+				" using max value";
+				warn(locAt(start), msg);
+			}
+			return produceIntLitToken(start, take(p));
+		}
+		if (((u | 0x20) >= 'a' && (u | 0x20) <= 'z') || u == '_'){
+			p = run<IDENT_CHARS>(p + 1, end);
+			size_t length = take(p);
+			int tag = keywordTag(start, length);
+			if (tag != TokenTag::ID){
+				return produceNullaryToken(tag);
+			}
+			return produceIDToken(start, length);
+		}
+
+		std::string msg = "Illegal character ";
+		msg += c;
+		error(locAt(start), msg);
+		p++;
+	}
+	cursor = end;
+	markToken(end, 0);
+	return TokenTag::END;
+}
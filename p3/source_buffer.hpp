@@ -0,0 +1,42 @@
+#ifndef __LILC_SOURCE_BUFFER_HPP__
+#define __LILC_SOURCE_BUFFER_HPP__ 1
+
+#include <cstddef>
+
+namespace LILC{
+
+/*
+A read-only view of a whole source file, memory-mapped so the scanner
+can run over it in place. The mapping is private and writable because
+flex temporarily stores a NUL after each lexeme; pages it touches are
+copied on write, the file itself is never modified. At least PADDING
+zero bytes follow the last source byte, which is the end-of-buffer
+marker flex expects from yy_scan_buffer.
+ */
+class SourceBuffer{
+public:
+   SourceBuffer() = default;
+   ~SourceBuffer(){ release(); }
+   SourceBuffer(const SourceBuffer&) = delete;
+   SourceBuffer& operator=(const SourceBuffer&) = delete;
+
+   // Map filename. Returns false (and maps nothing) for anything that
+   // is not a non-empty regular file, e.g. pipes, so the caller can
+   // fall back to reading the file as a stream.
+   bool map(const char * const filename);
+   void release();
+
+   bool mapped() const { return base != nullptr; }
+   char * data() const { return base; }
+   size_t size() const { return length; }
+
+   static const size_t PADDING = 2;
+private:
+   char * base = nullptr;
+   size_t length = 0;
+   size_t mappingSize = 0;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_SOURCE_BUFFER_HPP__ */
@@ -0,0 +1,72 @@
+#ifndef __LILC_SOURCE_LOC_HPP__
+#define __LILC_SOURCE_LOC_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace LILC{
+
+/*
+Where a token or AST node starts, as a byte offset into the source.
+Line and column are not stored anywhere; a LineTable for the source
+turns a SourceLoc into them when a diagnostic needs them.
+ */
+struct SourceLoc{
+   constexpr SourceLoc() : offset(0) {}
+   constexpr explicit SourceLoc(uint32_t at) : offset(at) {}
+
+   uint32_t offset;
+};
+
+inline bool operator==(SourceLoc a, SourceLoc b){ return a.offset == b.offset; }
+inline bool operator!=(SourceLoc a, SourceLoc b){ return a.offset != b.offset; }
+
+inline std::ostream & operator<<(std::ostream & out, SourceLoc loc){
+	return out << "@" << loc.offset;
+}
+
+// 1-based line, and 1-based column counted in bytes
+struct LineColumn{
+   uint32_t line;
+   uint32_t column;
+};
+
+/*
+The offsets at which the lines of a source start, built in one
+vectorized pass over the text and searched with a binary search.
+
+edit keeps the table up to date as the source is edited, at a cost
+that follows the size of the edit: the starts are kept as a gap
+buffer positioned at the last edit, and starts after the gap are
+stored minus shift, so moving all of them takes one addition.
+ */
+class LineTable{
+public:
+   void build(const char * text, size_t size);
+
+   LineColumn position(SourceLoc loc) const;
+   size_t lineCount() const { return starts.size() - gapLength; }
+
+   // text is the source after replacing removed bytes at offset with
+   // inserted new ones
+   void edit(const char * text, size_t offset, size_t removed,
+             size_t inserted);
+private:
+   uint32_t startOf(size_t line) const {
+	return line < gapBegin ? starts[line] : starts[line + gapLength] + shift;
+   }
+   // Index of the first line starting after offset
+   size_t lineAfter(uint32_t offset) const;
+   void moveGap(size_t index);
+
+   std::vector<uint32_t> starts;
+   size_t gapBegin = 0;
+   size_t gapLength = 0;
+   uint32_t shift = 0;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_SOURCE_LOC_HPP__ */
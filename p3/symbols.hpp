@@ -2,50 +2,63 @@
 #define LILC_SEMANTIC_SYMBOL_H
 
 #include <iostream>
+#include "interner.hpp"
+#include "literals.hpp"
+#include "source_loc.hpp"
 
 namespace LILC{
 
 class SynSymbol {
 	public:
-		std::string name;
-		SynSymbol(size_t line, size_t column, int tag){ this->_tag = tag; }
+		SynSymbol(SourceLoc loc, int tag){ this->_loc = loc; this->_tag = tag; }
 		int tag() { return _tag; }
-		size_t line;
-		size_t column;
+		SourceLoc loc() { return _loc; }
 
 	protected:
+		SourceLoc _loc;
 		int _tag;
 };
 
 class NullaryToken : public SynSymbol {
 	public:
-		NullaryToken(size_t line, size_t col, int tag) : SynSymbol(line,col,tag) { };
+		NullaryToken(SourceLoc loc, int tag) : SynSymbol(loc,tag) { };
 		int token() { return _tag; } 
 		
 };
 
+// Literal tokens keep their spelling in the source buffer, which lives
+// as long as the tokens do, and decode it only when asked to.
 class IntLitToken : public SynSymbol {
 	public:
-		IntLitToken(size_t line, size_t col, int value); //Defined in lilc_lexer.l
-		int value() { return _value; }
+		IntLitToken(SourceLoc loc, const char * text, uint32_t length); //Defined in lilc_lexer.l
+		// Clamped to INT_MAX; the scanner has already warned if it was
+		int value() { bool overflow; return decodeIntLit(_text, _length, overflow); }
 	private:
-		int _value;
+		const char * _text;
+		uint32_t _length;
 };
 
 class IDToken : public SynSymbol {
 	public:
-		IDToken(size_t line, size_t col, std::string id); //Defined in lilc_lexer.l
-		std::string value() { return _value; }
+		IDToken(SourceLoc loc, Atom id); //Defined in lilc_lexer.l
+		Atom value() { return _value; }
 	private:
-		std::string _value;
+		Atom _value;
 };
 
 class StringLitToken : public SynSymbol {
 	public:
-		StringLitToken(size_t line, size_t col, std::string value); //Defined in lilc_lexer.l
-		std::string value() { return _value; }
+		StringLitToken(SourceLoc loc, const char * text, uint32_t length); //Defined in lilc_lexer.l
+		// The literal as written, quotes and escapes included
+		const char * text() { return _text; }
+		size_t length() { return _length; }
+		// The characters it stands for, escapes decoded into arena
+		const char * decode(Arena &arena, size_t &length){
+			return decodeStringLit(_text, _length, arena, length);
+		}
 	private:
-		std::string _value;
+		const char * _text;
+		uint32_t _length;
 };
 
 } //End namespace
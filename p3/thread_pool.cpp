@@ -0,0 +1,81 @@
+#include "thread_pool.hpp"
+
+LILC::ThreadPool::ThreadPool(size_t threads)
+{
+   for (size_t i = 1; i < threads; i++){
+      workers.emplace_back(&ThreadPool::work, this);
+   }
+}
+
+LILC::ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> guard(lock);
+      stopping = true;
+   }
+   wake.notify_all();
+   for (std::thread &worker : workers){
+      worker.join();
+   }
+}
+
+size_t LILC::ThreadPool::hardwareThreads()
+{
+   unsigned n = std::thread::hardware_concurrency();
+   return n == 0 ? 1 : n;
+}
+
+void LILC::ThreadPool::forEach(size_t count,
+const std::function<void(size_t)> &body)
+{
+   if (count == 0){
+      return;
+   }
+   {
+      std::lock_guard<std::mutex> guard(lock);
+      job = &body;
+      jobCount = count;
+      nextItem = 0;
+      unfinished = count;
+      generation++;
+   }
+   wake.notify_all();
+   runItems();
+   std::unique_lock<std::mutex> guard(lock);
+   done.wait(guard, [this]{ return unfinished == 0; });
+   job = nullptr;
+}
+
+void LILC::ThreadPool::work()
+{
+   size_t seen = 0;
+   while (true){
+      {
+         std::unique_lock<std::mutex> guard(lock);
+         wake.wait(guard, [&]{ return stopping || generation != seen; });
+         if (stopping){
+            return;
+         }
+         seen = generation;
+      }
+      runItems();
+   }
+}
+
+// Claim and run items of the current job until none are left. Items
+// are meant to be coarse (a chunk of a file, a whole function), so
+// taking the lock per item costs nothing worth measuring.
+void LILC::ThreadPool::runItems()
+{
+   std::unique_lock<std::mutex> guard(lock);
+   while (nextItem < jobCount){
+      size_t item = nextItem++;
+      const std::function<void(size_t)> &body = *job;
+      guard.unlock();
+      body(item);
+      guard.lock();
+      if (--unfinished == 0){
+         done.notify_all();
+      }
+   }
+}
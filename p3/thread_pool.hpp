@@ -0,0 +1,53 @@
+#ifndef __LILC_THREAD_POOL_HPP__
+#define __LILC_THREAD_POOL_HPP__ 1
+
+#include <cstddef>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace LILC{
+
+/*
+A fixed set of worker threads for data-parallel passes. forEach runs
+body(0) .. body(count-1), each exactly once, spread over the workers
+and the calling thread, and returns when all of them have finished.
+Only one forEach may be in progress at a time.
+ */
+class ThreadPool{
+public:
+   // threads counts the calling thread, so ThreadPool(1) starts no
+   // workers and forEach just runs the loop.
+   explicit ThreadPool(size_t threads);
+   ~ThreadPool();
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   size_t size() const { return workers.size() + 1; }
+
+   void forEach(size_t count, const std::function<void(size_t)> &body);
+
+   // Threads worth using on this machine (at least 1)
+   static size_t hardwareThreads();
+private:
+   void work();
+   void runItems();
+
+   std::vector<std::thread> workers;
+   std::mutex lock;
+   std::condition_variable wake;
+   std::condition_variable done;
+   // The current job; generation changes when a new one is posted
+   const std::function<void(size_t)> *job = nullptr;
+   size_t jobCount = 0;
+   size_t nextItem = 0;
+   size_t unfinished = 0;
+   size_t generation = 0;
+   bool stopping = false;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_THREAD_POOL_HPP__ */
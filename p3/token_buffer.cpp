@@ -0,0 +1,78 @@
+#include <string>
+
+#include "lilc_scanner.hpp"
+
+using TokenTag = LILC::LilC_Parser::token;
+
+void LILC::LilC_Scanner::tokenize()
+{
+   batch.clear();
+   batchNext = 0;
+   // Generated code averages a token every four bytes or so
+   batch.reserve(static_cast<size_t>(bufferEnd - bufferStart) / 4 + 1);
+   while (true){
+      int tag = backend == Backend::SIMD ? simdLex(nullptr) : flexLex(nullptr);
+      if (tag == TokenTag::END){
+         // END is also returned after the string literal errors that
+         // stop scanning, so place it after the last match either way
+         batch.push(tag, locAt(tokenStart + tokenLength).offset, 0);
+         resetGap();
+         return;
+      }
+      batch.push(tag, locAt(tokenStart).offset,
+         static_cast<uint32_t>(tokenLength));
+   }
+}
+
+int LILC::LilC_Scanner::bufferedLex( LILC::LilC_Parser::semantic_type * const lval,
+SourceLoc * const lloc )
+{
+   if (ring != nullptr && batchNext == batch.size()){
+      if (ring->take(batch)){ batchNext = 0; }
+      resetGap();
+   }
+   closeGap();
+   size_t i = batchNext < batch.size() ? batchNext++ : batch.size() - 1;
+   int tag = batch.tags[i];
+   SourceLoc loc(batch.starts[i]);
+   const char * text = bufferStart + (batch.starts[i] - locBase);
+   size_t length = batch.lengths[i];
+   if (lloc != nullptr){
+      *lloc = loc;
+   }
+   switch (tag){
+   case TokenTag::ID:
+      lval->emplace<IDToken *>(tokens.make<IDToken>(loc,
+         atoms != nullptr ? *atoms++ : names.intern(text, length)));
+      break;
+   case TokenTag::INTLITERAL:
+      lval->emplace<IntLitToken *>(tokens.make<IntLitToken>(loc, text,
+         static_cast<uint32_t>(length)));
+      break;
+   case TokenTag::STRINGLITERAL:
+      lval->emplace<StringLitToken *>(tokens.make<StringLitToken>(loc, text,
+         static_cast<uint32_t>(length)));
+      break;
+   default:
+      break;
+   }
+   return tag;
+}
+
+void LILC::LilC_Scanner::clearValue(int tag,
+LILC::LilC_Parser::semantic_type &value)
+{
+   switch (tag){
+   case TokenTag::ID:
+      value.destroy<IDToken *>();
+      break;
+   case TokenTag::INTLITERAL:
+      value.destroy<IntLitToken *>();
+      break;
+   case TokenTag::STRINGLITERAL:
+      value.destroy<StringLitToken *>();
+      break;
+   default:
+      break;
+   }
+}
@@ -0,0 +1,50 @@
+#ifndef __LILC_TOKEN_BUFFER_HPP__
+#define __LILC_TOKEN_BUFFER_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace LILC{
+
+/*
+A whole token stream, stored column-wise so that a pass interested in
+only the tags (or only the positions) touches nothing else. Token i has
+tag tags[i] and is the lengths[i] bytes starting at byte starts[i] of
+the source (its SourceLoc). A complete stream ends with END.
+ */
+struct TokenBuffer{
+	std::vector<uint16_t> tags;
+	std::vector<uint32_t> starts;
+	std::vector<uint32_t> lengths;
+
+	size_t size() const { return tags.size(); }
+
+	void clear(){
+		tags.clear();
+		starts.clear();
+		lengths.clear();
+	}
+
+	void resize(size_t count){
+		tags.resize(count);
+		starts.resize(count);
+		lengths.resize(count);
+	}
+
+	void reserve(size_t count){
+		tags.reserve(count);
+		starts.reserve(count);
+		lengths.reserve(count);
+	}
+
+	void push(int tag, uint32_t start, uint32_t length){
+		tags.push_back(static_cast<uint16_t>(tag));
+		starts.push_back(start);
+		lengths.push_back(length);
+	}
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_TOKEN_BUFFER_HPP__ */
@@ -0,0 +1,137 @@
+#ifndef __LILC_TOKEN_DUMP_HPP__
+#define __LILC_TOKEN_DUMP_HPP__ 1
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+#include "grammar.hh"
+
+namespace LILC{
+
+/*
+What scan prints for each token tag: the whole line for fixed tokens,
+the prefix before the value for ID, INTLITERAL and STRINGLITERAL, and
+nullptr for tags the scanner never returns.
+ */
+struct TokenSpellings{
+   static const int LAST = LilC_Parser::token::ASSIGN;
+   const char * text[LAST + 1];
+   unsigned char length[LAST + 1];
+};
+
+constexpr size_t spellingLength(const char * s){
+	size_t n = 0;
+	while (s[n] != '\0'){ n++; }
+	return n;
+}
+
+constexpr TokenSpellings makeTokenSpellings(){
+	using T = LilC_Parser::token;
+	TokenSpellings t{};
+	t.text[T::END] = "EOF";
+	t.text[T::BOOL] = "bool";
+	t.text[T::INT] = "int";
+	t.text[T::VOID] = "void";
+	t.text[T::TRUE] = "true";
+	t.text[T::FALSE] = "false";
+	t.text[T::STRUCT] = "struct";
+	t.text[T::INPUT] = "input";
+	t.text[T::OUTPUT] = "output";
+	t.text[T::IF] = "if";
+	t.text[T::ELSE] = "else";
+	t.text[T::WHILE] = "while";
+	t.text[T::RETURN] = "return";
+	t.text[T::ID] = "ID:";
+	t.text[T::INTLITERAL] = "INTLIT:";
+	t.text[T::STRINGLITERAL] = "STRINGLIT:";
+	t.text[T::LCURLY] = "{";
+	t.text[T::RCURLY] = "}";
+	t.text[T::LPAREN] = "(";
+	t.text[T::RPAREN] = ")";
+	t.text[T::SEMICOLON] = ";";
+	t.text[T::COMMA] = ",";
+	t.text[T::DOT] = ".";
+	t.text[T::WRITE] = "<<";
+	t.text[T::READ] = ">>";
+	t.text[T::PLUSPLUS] = "++";
+	t.text[T::MINUSMINUS] = "--";
+	t.text[T::PLUS] = "+";
+	t.text[T::MINUS] = "-";
+	t.text[T::TIMES] = "*";
+	t.text[T::DIVIDE] = "/";
+	t.text[T::NOT] = "!";
+	t.text[T::AND] = "&&";
+	t.text[T::OR] = "||";
+	t.text[T::EQUALS] = "==";
+	t.text[T::NOTEQUALS] = "!=";
+	t.text[T::LESS] = "<";
+	t.text[T::GREATER] = ">";
+	t.text[T::LESSEQ] = "<=";
+	t.text[T::GREATEREQ] = ">=";
+	t.text[T::ASSIGN] = "=";
+	for (int tag = 0; tag <= TokenSpellings::LAST; tag++){
+		if (t.text[tag] != nullptr){
+			t.length[tag] = static_cast<unsigned char>(
+				spellingLength(t.text[tag]));
+		}
+	}
+	return t;
+}
+
+constexpr TokenSpellings TOKEN_SPELLINGS = makeTokenSpellings();
+
+static_assert(TOKEN_SPELLINGS.text[LilC_Parser::token::LESSEQ][0] == '<',
+	"LESSEQ is spelled <=");
+
+/*
+Writes the token stream of a scan. Output is collected in one large
+buffer that goes to the stream in a single write whenever it fills up
+and on flush (or destruction), instead of a flush per token.
+
+TEXT is the P2 scanner test format: one line per token, as spelled in
+TOKEN_SPELLINGS, with the value after the prefix for ID, INTLIT and
+STRINGLIT. BINARY is a compact form for other tools: the 8 bytes
+"LILCTOK\1", then per token its tag as an unsigned LEB128 varint,
+followed for ID and STRINGLITERAL by the varint length and bytes of
+the text and for INTLITERAL by the varint value. The END tag (0) is
+the last record.
+ */
+class TokenDump{
+public:
+   enum class Format { TEXT, BINARY };
+
+   TokenDump(std::ostream &out, Format format);
+   ~TokenDump(){ flush(); }
+   TokenDump(const TokenDump&) = delete;
+   TokenDump& operator=(const TokenDump&) = delete;
+
+   // A token without a value
+   void token(int tag);
+   void id(const char * text, size_t length);
+   void intLit(int value);
+   void stringLit(const char * text, size_t length);
+
+   void flush();
+
+   static const size_t CAPACITY = 1 << 20;
+private:
+   // Make room for n more bytes, writing out the buffer if needed
+   char * reserve(size_t n){
+	if (n > CAPACITY - used){ flush(); }
+	return buffer.data() + used;
+   }
+   void bytes(const char * text, size_t length);
+   void varint(uint64_t value);
+   void valued(int tag, const char * text, size_t length);
+
+   std::ostream &out;
+   Format format;
+   std::vector<char> buffer;
+   size_t used = 0;
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_TOKEN_DUMP_HPP__ */
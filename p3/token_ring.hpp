@@ -0,0 +1,102 @@
+#ifndef __LILC_TOKEN_RING_HPP__
+#define __LILC_TOKEN_RING_HPP__ 1
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "token_buffer.hpp"
+
+namespace LILC{
+
+/*
+Bounded single-producer, single-consumer queue of token batches, for
+a scanner on one thread feeding a parser on another. The producer
+fills the batch claim gives it and publishes it; the consumer takes
+published batches in order, swapping each with the buffer it has
+finished with, which goes back into the ring to be filled again. The
+buffers are made once and recycled, so however long the input the
+tokens in flight never take more than SLOTS batches of BATCH tokens.
+
+The two sides share nothing but the two indices, each written by one
+side only, and the done and quit flags; there are no locks. A side
+that has to wait spins briefly and then yields, which keeps a waiting
+thread off a core the other one could use.
+ */
+class TokenRing{
+public:
+	// A power of two
+	static const size_t SLOTS = 16;
+	static const size_t BATCH = 4096;
+
+	TokenRing() : slots(SLOTS) {}
+	TokenRing(const TokenRing&) = delete;
+	TokenRing& operator=(const TokenRing&) = delete;
+
+	// Producer: the empty batch to fill next, once there is room for
+	// it, or nullptr if the consumer has quit
+	TokenBuffer * claim(){
+		size_t t = tail.load(std::memory_order_relaxed);
+		waitFor([&]{
+			return t - head.load(std::memory_order_acquire) < SLOTS
+				|| quitting.load(std::memory_order_acquire);
+		});
+		if (quitting.load(std::memory_order_acquire)){
+			return nullptr;
+		}
+		TokenBuffer & batch = slots[t & (SLOTS - 1)];
+		batch.clear();
+		batch.reserve(BATCH);
+		return &batch;
+	}
+	// Producer: hand over the batch from claim
+	void publish(){
+		tail.store(tail.load(std::memory_order_relaxed) + 1,
+			std::memory_order_release);
+	}
+	// Producer: nothing more is coming
+	void finish(){ done.store(true, std::memory_order_release); }
+
+	// Consumer: swap the next batch into into, waiting for one if
+	// need be; false, leaving into alone, once the producer has
+	// finished and every batch has been taken
+	bool take(TokenBuffer & into){
+		size_t h = head.load(std::memory_order_relaxed);
+		waitFor([&]{
+			return h != tail.load(std::memory_order_acquire)
+				|| done.load(std::memory_order_acquire);
+		});
+		// done is set after the last publish, so tail is final now
+		if (h == tail.load(std::memory_order_acquire)){
+			return false;
+		}
+		std::swap(into.tags, slots[h & (SLOTS - 1)].tags);
+		std::swap(into.starts, slots[h & (SLOTS - 1)].starts);
+		std::swap(into.lengths, slots[h & (SLOTS - 1)].lengths);
+		head.store(h + 1, std::memory_order_release);
+		return true;
+	}
+	// Consumer: stop reading; claim returns nullptr from now on
+	void quit(){ quitting.store(true, std::memory_order_release); }
+private:
+	template <typename F>
+	static void waitFor(F && ready){
+		for (int spins = 0; !ready(); spins++){
+			if (spins >= 64){ std::this_thread::yield(); }
+		}
+	}
+
+	std::vector<TokenBuffer> slots;
+	// Batches taken and published so far; on lines of their own so
+	// the two sides don't keep taking the line from each other
+	alignas(64) std::atomic<size_t> head{0};
+	alignas(64) std::atomic<size_t> tail{0};
+	alignas(64) std::atomic<bool> done{false};
+	std::atomic<bool> quitting{false};
+};
+
+} /* end namespace */
+
+#endif /* END __LILC_TOKEN_RING_HPP__ */
@@ -1,355 +1,351 @@
-#include "ast.hpp"
+#include <algorithm>
 
-namespace LILC{
+#include "ast_cache.hpp"
+#include "ast_walker.hpp"
+#include "output_buffer.hpp"
+#include "thread_pool.hpp"
 
-void ProgramNode::unparse(std::ostream& out, int indent){
-	myDeclList->unparse(out, indent);
-}
+namespace LILC{
 
-void DeclListNode::unparse(std::ostream& out, int indent){
-	for (std::list<DeclNode *>::iterator it=myDecls.begin();
-		it != myDecls.end(); ++it){
-	    DeclNode * elt = *it;
-	    elt->unparse(out, indent);
+namespace {
+
+OutputBuffer & operator<<(OutputBuffer & out, Atom name){
+	out.write(name.c_str(), name.size());
+	return out;
+}
+
+OutputBuffer & operator<<(OutputBuffer & out, ASTImage::Spelling name){
+	out.write(name.chars, name.length);
+	return out;
+}
+
+/*
+Writes a tree back out as Lil' C, in any of its representations. Each
+node writes its own text in pieces: what comes before its first child
+in pre, what goes between two children in beforeChild, and the rest in
+post. The int passed down is the indentation. Everything goes to an
+OutputBuffer, which writes the whole text to the stream at the end.
+ */
+template <typename Tree>
+class Unparser : public TreeWalker<Unparser<Tree>, Tree, int>{
+	typedef TreeWalker<Unparser<Tree>, Tree, int> Walker;
+	using Walker::tree;
+public:
+	typedef typename Tree::Node Node;
+
+	Unparser(const Tree & tree, OutputBuffer& out) : Walker(tree), out(out){}
+
+	template <NodeKind K>
+	void pre(Node n, int indent){
+		switch (K){
+		case NodeKind::VAR_DECL:
+		case NodeKind::FN_DECL:
+		case NodeKind::FORMAL_DECL:
+		case NodeKind::FN_BODY:
+		case NodeKind::ASSIGN_STMT:
+		case NodeKind::POST_INC_STMT:
+		case NodeKind::POST_DEC_STMT:
+		case NodeKind::CALL_STMT:
+		case NodeKind::ASSIGN:
+		case NodeKind::CALL_EXP:
+			doIndent(indent);
+			break;
+		case NodeKind::STRUCT_DECL:
+			doIndent(indent);
+			out << "struct ";
+			break;
+		case NodeKind::READ_STMT:
+			doIndent(indent);
+			out << "cout << ";
+			break;
+		case NodeKind::WRITE_STMT:
+			doIndent(indent);
+			out << "cin >> ";
+			break;
+		case NodeKind::IF_STMT:
+		case NodeKind::IF_ELSE_STMT:
+			doIndent(indent);
+			out << "if(";
+			break;
+		case NodeKind::WHILE_STMT:
+			doIndent(indent);
+			out<< "while(";
+			break;
+		case NodeKind::RETURN_STMT:
+			doIndent(indent);
+			out<<"return ";
+			break;
+		case NodeKind::DOT_ACCESS:
+			doIndent(indent);
+			out << "(";
+			break;
+		case NodeKind::UNARY_MINUS:
+			doIndent(indent);
+			out << "(-";
+			break;
+		case NodeKind::NOT:
+			doIndent(indent);
+			out << "!(";
+			break;
+		case NodeKind::PLUS:
+		case NodeKind::MINUS:
+		case NodeKind::TIMES:
+		case NodeKind::DIVIDE:
+		case NodeKind::AND:
+		case NodeKind::OR:
+		case NodeKind::EQUALS:
+		case NodeKind::NOT_EQUALS:
+		case NodeKind::LESS:
+		case NodeKind::GREATER:
+		case NodeKind::LESS_EQ:
+		case NodeKind::GREATER_EQ:
+			doIndent(indent);
+			out << "(";
+			break;
+		case NodeKind::INT_LIT:
+			out << tree.intValue(n);
+			break;
+		case NodeKind::STR_LIT:
+			out.write(tree.strText(n), tree.strLength(n));
+			break;
+		case NodeKind::TRUE_LIT:
+			out << "true";
+			break;
+		case NodeKind::FALSE_LIT:
+			out << "false";
+			break;
+		case NodeKind::ID:
+			out << tree.name(n);
+			break;
+		case NodeKind::STRUCT_TYPE:
+			out << "struct ";
+			break;
+		case NodeKind::INT_TYPE:
+			out << "int";
+			break;
+		case NodeKind::BOOL_TYPE:
+			out << "bool";
+			break;
+		case NodeKind::VOID_TYPE:
+			out << "void";
+			break;
+		default:
+			break;
+		}
 	}
-}
-
-void VarDeclNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myType->unparse(out, 0);
-	out << " ";
-	myId->unparse(out, 0);
-	out << ";\n";
-}
 
-void StmtListNode::unparse(std::ostream& out, int indent){
-	for (std::list<StmtNode *>::iterator it=myStmts.begin();
-		it != myStmts.end(); ++it){
-	    StmtNode * elt = *it;
-	    elt->unparse(out, indent);
+	template <NodeKind K>
+	int beforeChild(Node, size_t i, int indent){
+		switch (K){
+		case NodeKind::PROGRAM:
+		case NodeKind::DECL_LIST:
+		case NodeKind::STMT_LIST:
+			return indent;
+		case NodeKind::FORMALS_LIST:
+			if (i != 0){ out << ", "; }
+			return indent;
+		case NodeKind::EXP_LIST:
+			if (i != 0){ out << ", "; }
+			return 0;
+		case NodeKind::VAR_DECL:
+		case NodeKind::FORMAL_DECL:
+			if (i == 1){ out << " "; }
+			return 0;
+		case NodeKind::FN_DECL:
+			if (i == 1){ out << " "; }
+			if (i == 2){ out << " ("; }
+			if (i == 3){ out << "){\n"; return 1; }
+			return 0;
+		case NodeKind::STRUCT_DECL:
+			if (i == 1){ out << " {\n"; return 1; }
+			return 0;
+		case NodeKind::IF_STMT:
+		case NodeKind::IF_ELSE_STMT:
+			if (i == 0){ return 0; }
+			if (i == 1){ out << "){\n"; }
+			if (i == 3){
+				doIndent(indent);
+				out << "}\n";
+				doIndent(indent);
+				out<< "else {\n";
+			}
+			return indent + 1;
+		case NodeKind::WHILE_STMT:
+			if (i == 0){ return 0; }
+			if (i == 1){ out<<") {\n"; }
+			return indent + 1;
+		case NodeKind::CALL_STMT:
+			return indent;
+		case NodeKind::DOT_ACCESS:
+			if (i == 1){ out << "."; }
+			return 0;
+		case NodeKind::ASSIGN:
+			if (i == 1){ out << " = "; }
+			return 0;
+		case NodeKind::CALL_EXP:
+			if (i == 1){ out << "("; }
+			return 0;
+		case NodeKind::PLUS:
+		case NodeKind::MINUS:
+		case NodeKind::TIMES:
+		case NodeKind::DIVIDE:
+		case NodeKind::AND:
+		case NodeKind::OR:
+		case NodeKind::EQUALS:
+		case NodeKind::NOT_EQUALS:
+		case NodeKind::LESS:
+		case NodeKind::GREATER:
+		case NodeKind::LESS_EQ:
+		case NodeKind::GREATER_EQ:
+			if (i == 1){ binaryOperator(K); }
+			return 0;
+		default:
+			return 0;
+		}
 	}
-}
 
-void ExpListNode::unparse(std::ostream& out, int indent){
-	for (std::list<ExpNode *>::iterator it=myExps.begin();
-		it != myExps.end(); ++it){
-			if(it != myExps.begin())
-				out << ", ";
-	    ExpNode * elt = *it;
-	    elt->unparse(out, 0);
+	template <NodeKind K>
+	void post(Node, int indent){
+		switch (K){
+		case NodeKind::VAR_DECL:
+		case NodeKind::ASSIGN_STMT:
+		case NodeKind::READ_STMT:
+		case NodeKind::WRITE_STMT:
+		case NodeKind::CALL_STMT:
+		case NodeKind::RETURN_STMT:
+			out << ";\n";
+			break;
+		case NodeKind::FN_DECL:
+			out << "}\n";
+			break;
+		case NodeKind::FN_BODY:
+			out << "\n";
+			break;
+		case NodeKind::STRUCT_DECL:
+			out << "};\n";
+			break;
+		case NodeKind::POST_INC_STMT:
+			out << "++;\n";
+			break;
+		case NodeKind::POST_DEC_STMT:
+			out << "--;\n";
+			break;
+		case NodeKind::IF_STMT:
+		case NodeKind::IF_ELSE_STMT:
+		case NodeKind::WHILE_STMT:
+			doIndent(indent);
+			out << "}\n";
+			break;
+		case NodeKind::DOT_ACCESS:
+		case NodeKind::CALL_EXP:
+		case NodeKind::UNARY_MINUS:
+		case NodeKind::NOT:
+		case NodeKind::PLUS:
+		case NodeKind::MINUS:
+		case NodeKind::TIMES:
+		case NodeKind::DIVIDE:
+		case NodeKind::AND:
+		case NodeKind::OR:
+		case NodeKind::EQUALS:
+		case NodeKind::NOT_EQUALS:
+		case NodeKind::LESS:
+		case NodeKind::GREATER:
+		case NodeKind::LESS_EQ:
+		case NodeKind::GREATER_EQ:
+			out << ")";
+			break;
+		default:
+			break;
+		}
 	}
-}
-
-void FnDeclNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myType->unparse(out, 0);
-	out << " ";
-	myId->unparse(out, 0);
-	out << " (";
-	myFormalsList->unparse(out, 0);
-	out << "){\n";
-	myFnBody->unparse(out, 1);
-	out << "}\n";
-}
-
-void FormalsListNode::unparse(std::ostream& out, int indent){
-	for (std::list<FormalDeclNode *>::iterator it=myFormals.begin();
-		it != myFormals.end(); ++it){
-			if(it != myFormals.begin())
-				out << ", ";
-	    FormalDeclNode * elt = *it;
-	    elt->unparse(out, indent);
+private:
+	void doIndent(int indent){
+		out.spaces(indent);
 	}
-}
 
-void FormalDeclNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myType->unparse(out, 0);
-	out << " ";
-	myId->unparse(out, 0);
-}
-
-void FnBodyNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myDeclList->unparse(out, 0);
-	myStmtList->unparse(out, 0);
-	out << "\n";
-}
-
-void StructDeclNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "struct ";
-	myId->unparse(out, 0);
-	out << " {\n";
-	myDeclList->unparse(out, 1);
-	out << "};\n";
-}
-
-void AssignStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myAssignNode->unparse(out, 0);
-	out << ";\n";
-}
-
-void PostIncStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myExp->unparse(out, 0);
-	out << "++;\n";
-}
-
-void PostDecStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myExp->unparse(out, 0);
-	out << "--;\n";
-}
-
-void ReadStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "cout << ";
-	myExp->unparse(out, 0);
-	out << ";\n";
-}
-
-void WriteStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "cin >> ";
-	myExp->unparse(out, 0);
-	out << ";\n";
-}
-
-void IfStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "if(";
-	myExp->unparse(out, 0);
-	out<<"){\n";
-	myDeclList->unparse(out, indent+1);
-	myStmtList->unparse(out, indent+1);
-	doIndent(out,indent);
-	out << "}\n";
-}
-
-void IfElseStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "if(";
-	myExp->unparse(out, 0);
-	out<<"){\n";
-	myDeclList->unparse(out, indent+1);
-	myStmtList->unparse(out, indent+1);
-	doIndent(out,indent);
-	out << "}\n";
-	doIndent(out, indent);
-	out<< "else {\n";
-	myDeclList2->unparse(out, indent+1);
-	myStmtList2->unparse(out, indent+1);
-	doIndent(out, indent);
-	out<<"}\n";
-}
-
-void WhileStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out<< "while(";
-	myExp->unparse(out, 0);
-	out<<") {\n";
-	myDeclList->unparse(out, indent+1);
-	myStmtList->unparse(out, indent+1);
-	doIndent(out, indent);
-	out<<"}\n";
-}
-
-void CallStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myCall->unparse(out, indent);
-	out<<";\n";
-}
-
-void ReturnStmtNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out<<"return ";
-	myExp->unparse(out, 0);
-	out<<";\n";
-}
-
-void DotAccessNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExp->unparse(out, 0);
-	out << ".";
-	myId->unparse(out, 0);
-	out << ")";
-}
-
-void AssignNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myExpL->unparse(out, 0);
-	out << " = ";
-	myExpR->unparse(out, 0);
-}
-
-void CallExpNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	myId->unparse(out, 0);
-	out << "(";
-	myExpList->unparse(out, 0);
-	out << ")";
-}
-
-void UnaryMinusNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(-";
-	myExp->unparse(out, 0);
-	out << ")";
-}
-
-void NotNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "!(";
-	myExp->unparse(out, 0);
-	out << ")";
-}
-
-void PlusNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " + ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void MinusNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " - ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void TimesNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " * ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void DivideNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " / ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void AndNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " && ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void OrNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " || ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void EqualsNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " == ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void NotEqualsNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " != ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void LessNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " < ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void GreaterNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " > ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
-
-void LessEqNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " <= ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
+	// Called with K, so the one write left has a constant length
+	void binaryOperator(NodeKind kind){
+		switch (kind){
+		case NodeKind::PLUS:       out << " + "; break;
+		case NodeKind::MINUS:      out << " - "; break;
+		case NodeKind::TIMES:      out << " * "; break;
+		case NodeKind::DIVIDE:     out << " / "; break;
+		case NodeKind::AND:        out << " && "; break;
+		case NodeKind::OR:         out << " || "; break;
+		case NodeKind::EQUALS:     out << " == "; break;
+		case NodeKind::NOT_EQUALS: out << " != "; break;
+		case NodeKind::LESS:       out << " < "; break;
+		case NodeKind::GREATER:    out << " > "; break;
+		case NodeKind::LESS_EQ:    out << " <= "; break;
+		default:                   out << " >= "; break;
+		}
+	}
 
-void GreaterEqNode::unparse(std::ostream& out, int indent){
-	doIndent(out, indent);
-	out << "(";
-	myExpL->unparse(out, 0);
-	out << " >= ";
-	myExpR->unparse(out, 0);
-	out << ")";
-}
+	OutputBuffer& out;
+};
 
-void IntLitNode::unparse(std::ostream& out, int indent){
-	out << myVal;
-}
+// Runs of declarations per thread, so one long run doesn't hold up
+// the rest
+const size_t RUNS_PER_THREAD = 4;
 
-void StrLitNode::unparse(std::ostream& out, int indent){
-	out << myStrVal;
+/*
+A program's top-level declarations don't depend on each other, and its
+text is theirs one after another, each unparsed at indent 0. So runs of
+them are unparsed at the same time, each into a buffer of its own, and
+the buffers in order are the program's text.
+ */
+template <typename Tree>
+void unparseInParts(const Tree & tree, typename Tree::Node root,
+ThreadPool & pool, std::vector<OutputBuffer> & parts)
+{
+	typedef typename Tree::Node Node;
+	std::vector<Node> decls;
+	tree.template forEachChild<NodeKind::PROGRAM>(root, [&](size_t, Node list){
+		tree.template forEachChild<NodeKind::DECL_LIST>(list, [&](size_t, Node d){
+			decls.push_back(d);
+		});
+	});
+	size_t runs = std::min(decls.size(), pool.size() * RUNS_PER_THREAD);
+	parts.clear();
+	parts.resize(runs);
+	pool.forEach(runs, [&](size_t i){
+		Unparser<Tree> unparser(tree, parts[i]);
+		size_t end = decls.size() * (i + 1) / runs;
+		for (size_t d = decls.size() * i / runs; d < end; d++){
+			unparser.walk(decls[d], 0);
+		}
+	});
 }
 
-void TrueNode::unparse(std::ostream& out, int indent){
-	out << "true";
-}
+} // end anonymous namespace
 
-void FalseNode::unparse(std::ostream& out, int indent){
-	out << "false";
+void ASTNode::unparse(std::ostream& out, int indent){
+	OutputBuffer buffer(out);
+	ASTTree tree;
+	Unparser<ASTTree>(tree, buffer).walk(this, indent);
 }
 
-void IdNode::unparse(std::ostream& out, int indent){
-	out << myStrVal;
+void ProgramNode::unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts){
+	ASTTree tree;
+	unparseInParts(tree, this, pool, parts);
 }
 
-void StructNode::unparse(std::ostream& out, int indent) {
-	out << "struct ";
-	out << myId;
+void FlatAST::unparse(std::ostream& out) const{
+	OutputBuffer buffer(out);
+	Unparser<FlatAST>(*this, buffer).walk(root(), 0);
 }
 
-void IntNode::unparse(std::ostream& out, int indent){
-	out << "int";
+void FlatAST::unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts) const{
+	unparseInParts(*this, root(), pool, parts);
 }
 
-void BoolNode::unparse(std::ostream& out, int indent){
-	out << "bool";
+void ASTImage::unparse(std::ostream& out) const{
+	OutputBuffer buffer(out);
+	Unparser<ASTImage>(*this, buffer).walk(root(), 0);
 }
 
-void VoidNode::unparse(std::ostream& out, int indent){
-	out << "void";
+void ASTImage::unparse(ThreadPool & pool, std::vector<OutputBuffer> & parts) const{
+	unparseInParts(*this, root(), pool, parts);
 }
 
 } // End namespace LIL' C